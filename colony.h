@@ -0,0 +1,352 @@
+#pragma once
+
+#include "vector.h"
+
+#include <iterator>
+
+//      O(1)    (colony, hive).
+//     RawMemory      , 
+// ,    ,    .
+//     .       
+//    (jump-counting skipfield),       .
+//     -  ,   
+template <typename T>
+class Colony {
+    class Block;
+
+public:
+    static constexpr size_t MIN_BLOCK_CAPACITY = 8;
+    static constexpr size_t MAX_BLOCK_CAPACITY = 8192;
+
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+        BasicIterator() = default;
+
+        reference operator*() const noexcept {
+            return owner_->blocks_[block_][slot_];
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        BasicIterator& operator++() noexcept {
+            slot_ = owner_->blocks_[block_].Next(slot_);
+            owner_->SkipExhaustedBlocks(block_, slot_);
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.block_ == rhs.block_ && lhs.slot_ == rhs.slot_;
+        }
+
+        operator BasicIterator<true>() const noexcept {
+            return { owner_, block_, slot_ };
+        }
+
+    private:
+        friend class Colony;
+        friend class BasicIterator<!IsConst>;
+        using Owner = std::conditional_t<IsConst, const Colony, Colony>;
+
+        BasicIterator(Owner* owner, size_t block, size_t slot) noexcept
+            : owner_(owner)
+            , block_(block)
+            , slot_(slot) {
+        }
+
+        Owner* owner_ = nullptr;
+        size_t block_ = 0;
+        size_t slot_ = 0;
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    iterator begin() noexcept {
+        return MakeIterator<iterator>(this, 0, blocks_.Size() == 0 ? 0 : blocks_[0].First());
+    }
+
+    iterator end() noexcept {
+        return { this, blocks_.Size(), 0 };
+    }
+
+    const_iterator begin() const noexcept {
+        return const_cast<Colony&>(*this).begin();
+    }
+
+    const_iterator end() const noexcept {
+        return const_cast<Colony&>(*this).end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    Colony() = default;
+
+    //       
+    Colony(const Colony& other) {
+        for (const T& value : other) {
+            Emplace(value);
+        }
+    }
+
+    Colony(Colony&& other) noexcept {
+        Swap(other);
+    }
+
+    Colony& operator=(const Colony& rhs) {
+        if (this != &rhs) {
+            Colony rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    Colony& operator=(Colony&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(Colony& other) noexcept {
+        blocks_.Swap(other.blocks_);
+        free_blocks_.Swap(other.free_blocks_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    //      ,  
+    size_t Capacity() const noexcept {
+        size_t capacity = 0;
+        for (const Block& block : blocks_) {
+            capacity += block.Capacity();
+        }
+        return capacity;
+    }
+
+    //     .    ,  ,
+    //    
+    template <typename... Args>
+    iterator Emplace(Args&&... args) {
+        if (free_blocks_.Size() == 0) {
+            AddBlock();
+        }
+        const size_t block_index = free_blocks_[free_blocks_.Size() - 1];
+        Block& block = blocks_[block_index];
+        const size_t slot = block.Emplace(std::forward <Args>(args) ...);
+        if (!block.HasFree()) {
+            free_blocks_.PopBack();
+        }
+        ++size_;
+        return { this, block_index, slot };
+    }
+
+    iterator Insert(const T& value) {
+        return Emplace(value);
+    }
+
+    iterator Insert(T&& value) {
+        return Emplace(std::move(value));
+    }
+
+    //    O(1)     
+    iterator Erase(const_iterator pos) noexcept {
+        Block& block = blocks_[pos.block_];
+        const bool was_full = !block.HasFree();
+        //       ,     
+        const size_t next = block.Next(pos.slot_);
+        block.Erase(pos.slot_);
+        --size_;
+        if (was_full) {
+            //  free_blocks_    ,     
+            free_blocks_.PushBack(pos.block_);
+        }
+        return MakeIterator<iterator>(this, pos.block_, next);
+    }
+
+private:
+    using SlotIndex = uint16_t;
+    static constexpr SlotIndex NO_RUN = UINT16_MAX;
+    static_assert(MAX_BLOCK_CAPACITY < NO_RUN);
+
+    //        .     
+    struct RunLinks {
+        SlotIndex prev = NO_RUN;
+        SlotIndex next = NO_RUN;
+    };
+
+    class Block {
+    public:
+        //        
+        explicit Block(size_t capacity)
+            : slots_(capacity) {
+            assert(capacity > 0 && capacity <= MAX_BLOCK_CAPACITY);
+            skip_.Resize(capacity + 1);
+            links_.Resize(capacity);
+            skip_[0] = skip_[capacity - 1] = static_cast<SlotIndex>(capacity);
+            AddRun(0);
+        }
+
+        Block(Block&& other) noexcept {
+            Swap(other);
+        }
+
+        Block& operator=(Block&& rhs) noexcept {
+            Swap(rhs);
+            return *this;
+        }
+
+        void Swap(Block& other) noexcept {
+            slots_.Swap(other.slots_);
+            skip_.Swap(other.skip_);
+            links_.Swap(other.links_);
+            std::swap(free_run_, other.free_run_);
+        }
+
+        ~Block() {
+            if (Capacity() == 0) {
+                return;
+            }
+            for (size_t slot = First(); slot < Capacity(); slot = Next(slot)) {
+                std::destroy_at(slots_ + slot);
+            }
+        }
+
+        size_t Capacity() const noexcept {
+            return slots_.Capacity();
+        }
+
+        bool HasFree() const noexcept {
+            return free_run_ != NO_RUN;
+        }
+
+        //     Capacity(),   
+        size_t First() const noexcept {
+            return skip_[0];
+        }
+
+        //   slot    Capacity().
+        //   skip_  0      
+        size_t Next(size_t slot) const noexcept {
+            ++slot;
+            return slot + skip_[slot];
+        }
+
+        //             
+        template <typename... Args>
+        size_t Emplace(Args&&... args) {
+            const size_t slot = free_run_;
+            const size_t length = skip_[slot];
+            new (slots_ + slot) T(std::forward <Args>(args) ...);
+            RemoveRun(slot);
+            if (length > 1) {
+                skip_[slot + 1] = skip_[slot + length - 1] = static_cast<SlotIndex>(length - 1);
+                AddRun(slot + 1);
+            }
+            skip_[slot] = 0;
+            return slot;
+        }
+
+        //         
+        void Erase(size_t slot) noexcept {
+            std::destroy_at(slots_ + slot);
+            //      -        
+            const size_t left = slot > 0 ? skip_[slot - 1] : 0;
+            const size_t right = skip_[slot + 1];
+            if (right > 0) {
+                RemoveRun(slot + 1);
+            }
+            if (left == 0) {
+                AddRun(slot);
+            }
+            skip_[slot - left] = skip_[slot + right] = static_cast<SlotIndex>(left + 1 + right);
+        }
+
+        T& operator[](size_t slot) noexcept {
+            return slots_[slot];
+        }
+
+        const T& operator[](size_t slot) const noexcept {
+            return slots_[slot];
+        }
+
+    private:
+        RawMemory<T> slots_;
+        //       , 0   
+        Vector<SlotIndex> skip_;
+        Vector<RunLinks> links_;
+        //        
+        size_t free_run_ = NO_RUN;
+
+        void AddRun(size_t start) noexcept {
+            links_[start] = { NO_RUN, static_cast<SlotIndex>(free_run_) };
+            if (free_run_ != NO_RUN) {
+                links_[free_run_].prev = static_cast<SlotIndex>(start);
+            }
+            free_run_ = start;
+        }
+
+        void RemoveRun(size_t start) noexcept {
+            const RunLinks links = links_[start];
+            if (links.prev == NO_RUN) {
+                free_run_ = links.next;
+            }
+            else {
+                links_[links.prev].next = links.next;
+            }
+            if (links.next != NO_RUN) {
+                links_[links.next].prev = links.prev;
+            }
+        }
+    };
+
+    Vector<Block> blocks_;
+    //     ,    
+    Vector<size_t> free_blocks_;
+    size_t size_ = 0;
+
+    //       ,    
+    void AddBlock() {
+        if (free_blocks_.Capacity() < blocks_.Size() + 1) {
+            free_blocks_.Reserve(std::max(free_blocks_.Capacity() * 2, blocks_.Size() + 1));
+        }
+        const size_t capacity = std::clamp(Capacity(), MIN_BLOCK_CAPACITY, MAX_BLOCK_CAPACITY);
+        blocks_.EmplaceBack(capacity);
+        free_blocks_.PushBack(blocks_.Size() - 1);
+    }
+
+    //      ,  slot    
+    void SkipExhaustedBlocks(size_t& block, size_t& slot) const noexcept {
+        while (block < blocks_.Size() && slot == blocks_[block].Capacity()) {
+            ++block;
+            slot = block < blocks_.Size() ? blocks_[block].First() : 0;
+        }
+    }
+
+    template <typename Iterator, typename Owner>
+    static Iterator MakeIterator(Owner* owner, size_t block, size_t slot) noexcept {
+        owner->SkipExhaustedBlocks(block, slot);
+        return { owner, block, slot };
+    }
+};
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+//   16- :     32-   .
+//       ,   Vector.
+//    MAX_SIZE     std::length_error
+template <typename T>
+class CompactVector {
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t MAX_SIZE = std::numeric_limits<uint32_t>::max();
+
+    iterator begin() noexcept {
+        return buffer_;
+    }
+
+    iterator end() noexcept {
+        return buffer_ + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return buffer_;
+    }
+
+    const_iterator end() const noexcept {
+        return buffer_ + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return buffer_;
+    }
+
+    const_iterator cend() const noexcept {
+        return buffer_ + size_;
+    }
+
+    CompactVector() = default;
+
+    explicit CompactVector(size_t size) {
+        RawMemory<T> data(CheckSize(size));
+        std::uninitialized_value_construct_n(data.GetAddress(), size);
+        Adopt(data);
+        size_ = static_cast<uint32_t>(size);
+    }
+
+    CompactVector(const CompactVector& other) {
+        RawMemory<T> data(other.size_);
+        std::uninitialized_copy_n(other.buffer_, other.size_, data.GetAddress());
+        Adopt(data);
+        size_ = other.size_;
+    }
+
+    CompactVector(CompactVector&& other) noexcept {
+        Swap(other);
+    }
+
+    CompactVector& operator=(const CompactVector& rhs) {
+        if (this != &rhs) {
+            if (rhs.size_ > capacity_) {
+                CompactVector rhs_copy(rhs);
+                Swap(rhs_copy);
+            }
+            else {
+                size_t copy_size{};
+                if (rhs.size_ <= size_) {
+                    copy_size = rhs.size_;
+                    std::destroy_n(buffer_ + rhs.size_, size_ - rhs.size_);
+                }
+                else {
+                    copy_size = size_;
+                    std::uninitialized_copy_n(rhs.buffer_ + size_, rhs.size_ - size_, buffer_ + size_);
+                }
+
+                std::copy_n(rhs.buffer_, copy_size, buffer_);
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+
+    CompactVector& operator=(CompactVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(CompactVector& other) noexcept {
+        std::swap(buffer_, other.buffer_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    ~CompactVector() {
+        std::destroy_n(buffer_, size_);
+        RawMemory<T> data(buffer_, capacity_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        RawMemory<T> new_data(CheckSize(new_capacity));
+
+        MoveOrCopyData(new_data);
+
+        std::destroy_n(buffer_, size_);
+        Replace(new_data);
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            std::destroy_n(buffer_ + new_size, size_ - new_size);
+        }
+        else {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(buffer_ + size_, new_size - size_);
+        }
+        size_ = static_cast<uint32_t>(new_size);
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        T* value_ = nullptr;
+        if (size_ == capacity_) {
+            RawMemory<T> new_data(NextCapacity());
+            value_ = new (new_data + size_) T(std::forward <Args>(args) ...);
+
+            MoveOrCopyData(new_data);
+
+            std::destroy_n(buffer_, size_);
+            Replace(new_data);
+        }
+        else {
+            value_ = new (buffer_ + size_) T(std::forward <Args>(args) ...);
+        }
+        ++size_;
+        return *value_;
+    }
+
+    void PopBack() noexcept {
+        std::destroy_at(end() - 1);
+        --size_;
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        if (size_ == capacity_) {
+            return EmplaceRealloc(pos, std::forward <Args>(args) ...);
+        }
+        return EmplaceMove(pos, std::forward <Args>(args) ...);
+    }
+
+    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        iterator pos_ = const_cast<iterator>(pos);
+        std::move(pos_ + 1, end(), pos_);
+        PopBack();
+        return pos_;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<CompactVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return buffer_[index];
+    }
+
+private:
+    T* buffer_ = nullptr;
+    uint32_t size_ = 0;
+    uint32_t capacity_ = 0;
+
+    static size_t CheckSize(size_t size) {
+        if (size > MAX_SIZE) {
+            throw std::length_error("CompactVector size exceeds 2^32 - 1 elements");
+        }
+        return size;
+    }
+
+    size_t NextCapacity() const {
+        if (size_ == MAX_SIZE) {
+            CheckSize(size_t{ size_ } + 1);
+        }
+        return size_ == 0 ? 1 : std::min(size_t{ size_ } * 2, MAX_SIZE);
+    }
+
+    //    data.     
+    void Adopt(RawMemory<T>& data) noexcept {
+        assert(buffer_ == nullptr);
+        capacity_ = static_cast<uint32_t>(data.Capacity());
+        buffer_ = data.Release();
+    }
+
+    //     new_data,  .    
+    //      
+    void Replace(RawMemory<T>& new_data) noexcept {
+        RawMemory<T> old_data(buffer_, capacity_);
+        buffer_ = nullptr;
+        Adopt(new_data);
+    }
+
+    void MoveOrCopyData(RawMemory<T>& new_data) {
+        // constexpr  if     
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(buffer_, size_, new_data.GetAddress());
+        }
+        else {
+            std::uninitialized_copy_n(buffer_, size_, new_data.GetAddress());
+        }
+    }
+
+    template <typename... Args>
+    iterator EmplaceRealloc(const_iterator pos, Args&&... args) {
+        size_t index_ = pos - begin();
+        iterator value_ptr = nullptr;
+
+        RawMemory<T> new_data(NextCapacity());
+        value_ptr = new (new_data + index_) T(std::forward <Args>(args) ...);
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(begin(), index_, new_data.GetAddress());
+        }
+        else {
+            try {
+                std::uninitialized_copy_n(begin(), index_, new_data.GetAddress());
+            }
+            catch (...) {
+                std::destroy_at(new_data.GetAddress() + index_);
+                throw;
+            }
+        }
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(begin() + index_, size_ - index_, new_data.GetAddress() + index_ + 1);
+        }
+        else {
+            try {
+                std::uninitialized_copy_n(begin() + index_, size_ - index_, new_data.GetAddress() + index_ + 1);
+            }
+            catch (...) {
+                std::destroy_n(new_data.GetAddress(), index_ + 1);
+                throw;
+            }
+        }
+        std::destroy_n(begin(), size_);
+        Replace(new_data);
+
+        ++size_;
+        return value_ptr;
+    }
+
+    template <typename... Args>
+    iterator EmplaceMove(const_iterator pos, Args&&... args) {
+        size_t index_ = pos - begin();
+        iterator value_ptr = begin() + index_;
+
+        if (index_ == size_) {
+            new (value_ptr) T(std::forward <Args>(args) ...);
+        }
+        else {
+            //      ,   
+            //    
+            T value(std::forward <Args>(args) ...);
+            new (buffer_ + size_) T(std::move(*(end() - 1)));
+            try {
+                std::move_backward(value_ptr, end() - 1, end());
+                *value_ptr = std::move(value);
+            }
+            catch (...) {
+                std::destroy_at(end());
+                throw;
+            }
+        }
+
+        ++size_;
+        return value_ptr;
+    }
+};
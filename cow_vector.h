@@ -0,0 +1,129 @@
+#pragma once
+
+#include "vector.h"
+
+#include <atomic>
+
+//     .  CowVector     
+//  ,    O(1).     ,
+//     ,      ().
+// ,    operator[],    
+template <typename T>
+class CowVector {
+public:
+    using const_iterator = const T*;
+
+    const_iterator begin() const noexcept {
+        return data_ == nullptr ? nullptr : data_->begin();
+    }
+
+    const_iterator end() const noexcept {
+        return data_ == nullptr ? nullptr : data_->end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    CowVector() = default;
+
+    //   values  
+    explicit CowVector(Vector<T>&& values)
+        : data_(std::make_shared<Vector<T>>(std::move(values))) {
+    }
+
+    //  ,   Vector::Freeze  CowVector::Freeze. 
+    //  , CowVector    ,    
+    //  :   std::make_shared<const Vector<T>>  
+    explicit CowVector(std::shared_ptr<const Vector<T>> frozen) noexcept
+        : data_(std::const_pointer_cast<Vector<T>>(std::move(frozen))) {
+    }
+
+    void Swap(CowVector& other) noexcept {
+        data_.swap(other.data_);
+    }
+
+    size_t Size() const noexcept {
+        return data_ == nullptr ? 0 : data_->Size();
+    }
+
+    // true,         
+    bool IsShared() const noexcept {
+        return data_ != nullptr && data_.use_count() > 1;
+    }
+
+    //        .
+    //     *this    
+    std::shared_ptr<const Vector<T>> Freeze() const {
+        //     ,       
+        return data_ == nullptr ? std::make_shared<Vector<T>>() : data_;
+    }
+
+    void Reserve(size_t new_capacity) {
+        Detach().Reserve(new_capacity);
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (IsShared()) {
+            //       , 
+            //   *this  
+            T value(std::forward <Args>(args) ...);
+            return Detach().EmplaceBack(std::move(value));
+        }
+        return Detach().EmplaceBack(std::forward <Args>(args) ...);
+    }
+
+    void PopBack() {
+        assert(Size() > 0);
+        Detach().PopBack();
+    }
+
+    //   pos.       
+    const_iterator Erase(const_iterator pos) {
+        const size_t index = pos - begin();
+        Vector<T>& values = Detach();
+        return values.Erase(values.begin() + index);
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        assert(index < Size());
+        return (*data_)[index];
+    }
+
+    T& operator[](size_t index) {
+        assert(index < Size());
+        return Detach()[index];
+    }
+
+private:
+    std::shared_ptr<Vector<T>> data_;
+
+    //  ,  *this  ,    
+    Vector<T>& Detach() {
+        if (data_ == nullptr) {
+            data_ = std::make_shared<Vector<T>>();
+        }
+        else if (data_.use_count() > 1) {
+            data_ = std::make_shared<Vector<T>>(*data_);
+        }
+        else {
+            //         . 
+            //       
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *data_;
+    }
+};
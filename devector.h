@@ -0,0 +1,289 @@
+#pragma once
+
+#include "vector.h"
+
+//  :   ,       .
+// PushFront/EmplaceFront/PopFront    O(1),  Insert  Erase
+//   ,  
+template <typename T>
+class Devector {
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept {
+        return data_.GetAddress() + front_;
+    }
+
+    iterator end() noexcept {
+        return begin() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.GetAddress() + front_;
+    }
+
+    const_iterator end() const noexcept {
+        return begin() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    Devector() = default;
+
+    explicit Devector(size_t size) : data_(size), size_(size)
+    {
+        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+    }
+
+    Devector(const Devector& other) : data_(other.size_), size_(other.size_)
+    {
+        std::uninitialized_copy_n(other.begin(), size_, data_.GetAddress());
+    }
+
+    Devector(Devector&& other) noexcept {
+        Swap(other);
+    }
+
+    Devector& operator=(const Devector& rhs) {
+        if (this != &rhs) {
+            Devector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    Devector& operator=(Devector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(Devector& other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(front_, other.front_);
+        std::swap(size_, other.size_);
+    }
+
+    ~Devector() {
+        std::destroy_n(begin(), size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    //     
+    size_t FrontCapacity() const noexcept {
+        return front_;
+    }
+
+    //     
+    size_t BackCapacity() const noexcept {
+        return data_.Capacity() - front_ - size_;
+    }
+
+    // ,       new_capacity - Size() 
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > size_ + BackCapacity()) {
+            Reallocate(front_, new_capacity - size_);
+        }
+    }
+
+    // ,       new_capacity - Size() 
+    void ReserveFront(size_t new_capacity) {
+        if (new_capacity > size_ + front_) {
+            Reallocate(new_capacity - size_, BackCapacity());
+        }
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            std::destroy_n(begin() + new_size, size_ - new_size);
+        }
+        else {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(end(), new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    void PushFront(const T& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(T&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        T* value_ = nullptr;
+        if (BackCapacity() == 0) {
+            const size_t new_front = KeptSlack(front_);
+            RawMemory<T> new_data(new_front + size_ + GrowthSlack());
+            value_ = new (new_data + new_front + size_) T(std::forward <Args>(args) ...);
+            Relocate(new_data, new_front, value_);
+        }
+        else {
+            value_ = new (end()) T(std::forward <Args>(args) ...);
+        }
+        ++size_;
+        return *value_;
+    }
+
+    template <typename... Args>
+    T& EmplaceFront(Args&&... args) {
+        T* value_ = nullptr;
+        if (front_ == 0) {
+            const size_t new_front = GrowthSlack();
+            RawMemory<T> new_data(new_front + size_ + KeptSlack(BackCapacity()));
+            value_ = new (new_data + new_front - 1) T(std::forward <Args>(args) ...);
+            Relocate(new_data, new_front, value_);
+        }
+        else {
+            value_ = new (begin() - 1) T(std::forward <Args>(args) ...);
+        }
+        --front_;
+        ++size_;
+        return *value_;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(end() - 1);
+        --size_;
+    }
+
+    void PopFront() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(begin());
+        ++front_;
+        --size_;
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        const size_t index = pos - begin();
+        if (index == size_) {
+            return &EmplaceBack(std::forward <Args>(args) ...);
+        }
+        if (index == 0) {
+            return &EmplaceFront(std::forward <Args>(args) ...);
+        }
+        //     ,     
+        T value(std::forward <Args>(args) ...);
+        if (index < size_ - index) {
+            if (front_ == 0) {
+                Reallocate(GrowthSlack(), KeptSlack(BackCapacity()));
+            }
+            new (begin() - 1) T(std::move(*begin()));
+            --front_;
+            ++size_;
+            std::move(begin() + 2, begin() + index + 1, begin() + 1);
+        }
+        else {
+            if (BackCapacity() == 0) {
+                Reallocate(KeptSlack(front_), GrowthSlack());
+            }
+            new (end()) T(std::move(*(end() - 1)));
+            ++size_;
+            std::move_backward(begin() + index, end() - 2, end() - 1);
+        }
+        T* value_ptr = begin() + index;
+        *value_ptr = std::move(value);
+        return value_ptr;
+    }
+
+    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        iterator pos_ = const_cast<iterator>(pos);
+        const size_t index = pos_ - begin();
+        if (index < size_ - index - 1) {
+            std::move_backward(begin(), pos_, pos_ + 1);
+            PopFront();
+            return begin() + index;
+        }
+        std::move(pos_ + 1, end(), pos_);
+        PopBack();
+        return pos_;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<Devector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[front_ + index];
+    }
+
+private:
+    RawMemory<T> data_;
+    size_t front_ = 0;
+    size_t size_ = 0;
+
+    // ,      
+    size_t GrowthSlack() const noexcept {
+        return std::max<size_t>(size_, 1);
+    }
+
+    //     ,     .
+    //    (PushBack + PopFront)      
+    size_t KeptSlack(size_t slack) const noexcept {
+        return std::min(slack, size_);
+    }
+
+    //      front_slack      back_slack  
+    void Reallocate(size_t front_slack, size_t back_slack) {
+        RawMemory<T> new_data(front_slack + size_ + back_slack);
+        Relocate(new_data, front_slack, nullptr);
+    }
+
+    //    new_data,    new_front.    ,
+    //    new_data  emplaced 
+    void Relocate(RawMemory<T>& new_data, size_t new_front, T* emplaced) {
+        // constexpr  if     
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(begin(), size_, new_data + new_front);
+        }
+        else {
+            try {
+                std::uninitialized_copy_n(begin(), size_, new_data + new_front);
+            }
+            catch (...) {
+                if (emplaced != nullptr) {
+                    std::destroy_at(emplaced);
+                }
+                throw;
+            }
+        }
+        std::destroy_n(begin(), size_);
+        data_.Swap(new_data);
+        front_ = new_front;
+    }
+};
@@ -0,0 +1,321 @@
+#pragma once
+
+#include "vector.h"
+
+#include <functional>
+#include <span>
+#include <tuple>
+
+//      Vector:    keys_  
+//  values_    .  -     ,   
+//    ,   std::map,       .
+// Compare   std::less<> - ,      ,
+//   K (, std::string_view  K = std::string),   K.
+// Insert  Emplace       ,      
+// pending_.           ( Size),
+//     Append,    m      O(n + m log m).
+//   - 1/PENDING_RATIO   ,    MIN_PENDING_CAPACITY,
+//         ,      O(log n).
+// ,   ,    ,   std::map::insert.
+//      const-,      
+//      .
+//        FlatMap   
+template <typename K, typename V, typename Compare = std::less<>>
+class FlatMap {
+public:
+    static constexpr size_t MIN_PENDING_CAPACITY = 16;
+    static constexpr size_t PENDING_RATIO = 8;
+
+    FlatMap() = default;
+
+    explicit FlatMap(Compare compare)
+        : compare_(std::move(compare)) {
+    }
+
+    //  FlatMap   (, ):   ,    .
+    //       ,       std::map
+    template <typename Pairs>
+    static FlatMap FromPairs(const Pairs& pairs, Compare compare = {}) {
+        FlatMap result(std::move(compare));
+        result.Append(pairs);
+        return result;
+    }
+
+    size_t Size() const {
+        MergePending();
+        return keys_.Size();
+    }
+
+    void Reserve(size_t new_capacity) {
+        keys_.Reserve(new_capacity);
+        values_.Reserve(new_capacity);
+    }
+
+    //  
+    std::span<const K> Keys() const {
+        MergePending();
+        return { keys_.begin(), keys_.Size() };
+    }
+
+    //    
+    std::span<V> Values() {
+        MergePending();
+        return { values_.begin(), values_.Size() };
+    }
+
+    std::span<const V> Values() const {
+        return const_cast<FlatMap&>(*this).Values();
+    }
+
+    template <typename Key>
+    bool Contains(const Key& key) const {
+        return Find(key) != nullptr;
+    }
+
+    template <typename Key>
+    V* Find(const Key& key) {
+        MergePending();
+        const size_t index = LowerBound(key);
+        return IsEqual(index, key) ? &values_[index] : nullptr;
+    }
+
+    template <typename Key>
+    const V* Find(const Key& key) const {
+        return const_cast<FlatMap&>(*this).Find(key);
+    }
+
+    //    key.       
+    //    
+    V& operator[](const K& key) {
+        MergePending();
+        const size_t index = LowerBound(key);
+        if (!IsEqual(index, key)) {
+            keys_.Insert(keys_.begin() + index, key);
+            try {
+                values_.Emplace(values_.begin() + index);
+            }
+            catch (...) {
+                keys_.Erase(keys_.begin() + index);
+                throw;
+            }
+        }
+        return values_[index];
+    }
+
+    //    .   key  ,     
+    template <typename... Args>
+    void Emplace(K key, Args&&... args) {
+        pending_.EmplaceBack(std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+            std::forward_as_tuple(std::forward <Args>(args) ...));
+        if (pending_.Size() >= PendingCapacity()) {
+            MergePending();
+        }
+    }
+
+    void Insert(K key, V value) {
+        Emplace(std::move(key), std::move(value));
+    }
+
+    //     pairs  .      
+    template <typename Pairs>
+    void Append(const Pairs& pairs) {
+        for (const auto& [key, value] : pairs) {
+            pending_.EmplaceBack(key, value);
+        }
+        MergePending();
+    }
+
+    template <typename Key>
+    bool Erase(const Key& key) {
+        MergePending();
+        const size_t index = LowerBound(key);
+        if (!IsEqual(index, key)) {
+            return false;
+        }
+        keys_.Erase(keys_.begin() + index);
+        values_.Erase(values_.begin() + index);
+        return true;
+    }
+
+private:
+    //      key     first
+    template <typename Key>
+    size_t LowerBound(const Key& key, size_t first = 0) const {
+        return std::lower_bound(keys_.begin() + first, keys_.end(), key, compare_) - keys_.begin();
+    }
+
+    template <typename Key>
+    bool IsEqual(size_t index, const Key& key) const {
+        return index != keys_.Size() && !compare_(key, keys_[index]);
+    }
+
+    size_t PendingCapacity() const noexcept {
+        return std::max(MIN_PENDING_CAPACITY, keys_.Size() / PENDING_RATIO);
+    }
+
+    //           .   
+    //    ,     -  
+    void MergePending() const {
+        if (pending_.Size() == 0) {
+            return;
+        }
+        std::stable_sort(pending_.begin(), pending_.end(), [this](const std::pair<K, V>& lhs, const std::pair<K, V>& rhs) {
+            return compare_(lhs.first, rhs.first);
+            });
+        Vector<K> keys;
+        Vector<V> values;
+        keys.Reserve(keys_.Size() + pending_.Size());
+        values.Reserve(keys_.Size() + pending_.Size());
+        //   index  ,      
+        size_t index = 0;
+        const auto take_until = [&](size_t bound) {
+            for (; index < bound; ++index) {
+                keys.EmplaceBack(std::move_if_noexcept(keys_[index]));
+                values.EmplaceBack(std::move_if_noexcept(values_[index]));
+            }
+        };
+        for (std::pair<K, V>& item : pending_) {
+            take_until(LowerBound(item.first, index));
+            const bool duplicate = IsEqual(index, item.first)
+                || (keys.Size() != 0 && !compare_(keys[keys.Size() - 1], item.first));
+            if (!duplicate) {
+                keys.EmplaceBack(std::move_if_noexcept(item.first));
+                values.EmplaceBack(std::move_if_noexcept(item.second));
+            }
+        }
+        take_until(keys_.Size());
+        keys_.Swap(keys);
+        values_.Swap(values);
+        while (pending_.Size() != 0) {
+            pending_.PopBack();
+        }
+    }
+
+    mutable Vector<K> keys_;
+    mutable Vector<V> values_;
+    mutable Vector<std::pair<K, V>> pending_;
+    [[no_unique_address]] Compare compare_;
+};
+
+//    Vector:     ,    FlatMap
+template <typename K, typename Compare = std::less<>>
+class FlatSet {
+public:
+    static constexpr size_t MIN_PENDING_CAPACITY = 16;
+    static constexpr size_t PENDING_RATIO = 8;
+
+    using const_iterator = const K*;
+    using iterator = const_iterator;
+
+    FlatSet() = default;
+
+    explicit FlatSet(Compare compare)
+        : compare_(std::move(compare)) {
+    }
+
+    //  FlatSet  :   ,    
+    template <typename Keys>
+    static FlatSet FromKeys(const Keys& keys, Compare compare = {}) {
+        FlatSet result(std::move(compare));
+        result.Append(keys);
+        return result;
+    }
+
+    const_iterator begin() const {
+        MergePending();
+        return keys_.begin();
+    }
+
+    const_iterator end() const {
+        MergePending();
+        return keys_.end();
+    }
+
+    size_t Size() const {
+        MergePending();
+        return keys_.Size();
+    }
+
+    void Reserve(size_t new_capacity) {
+        keys_.Reserve(new_capacity);
+    }
+
+    template <typename Key>
+    bool Contains(const Key& key) const {
+        MergePending();
+        return IsEqual(LowerBound(key), key);
+    }
+
+    //    ,    
+    void Insert(K key) {
+        pending_.PushBack(std::move(key));
+        if (pending_.Size() >= PendingCapacity()) {
+            MergePending();
+        }
+    }
+
+    //     keys  
+    template <typename Keys>
+    void Append(const Keys& keys) {
+        for (const auto& key : keys) {
+            pending_.EmplaceBack(key);
+        }
+        MergePending();
+    }
+
+    template <typename Key>
+    bool Erase(const Key& key) {
+        MergePending();
+        const size_t index = LowerBound(key);
+        if (!IsEqual(index, key)) {
+            return false;
+        }
+        keys_.Erase(keys_.begin() + index);
+        return true;
+    }
+
+private:
+    //      key     first
+    template <typename Key>
+    size_t LowerBound(const Key& key, size_t first = 0) const {
+        return std::lower_bound(keys_.begin() + first, keys_.end(), key, compare_) - keys_.begin();
+    }
+
+    template <typename Key>
+    bool IsEqual(size_t index, const Key& key) const {
+        return index != keys_.Size() && !compare_(key, keys_[index]);
+    }
+
+    size_t PendingCapacity() const noexcept {
+        return std::max(MIN_PENDING_CAPACITY, keys_.Size() / PENDING_RATIO);
+    }
+
+    void MergePending() const {
+        if (pending_.Size() == 0) {
+            return;
+        }
+        std::stable_sort(pending_.begin(), pending_.end(), compare_);
+        Vector<K> keys;
+        keys.Reserve(keys_.Size() + pending_.Size());
+        size_t index = 0;
+        for (K& key : pending_) {
+            for (const size_t bound = LowerBound(key, index); index < bound; ++index) {
+                keys.EmplaceBack(std::move_if_noexcept(keys_[index]));
+            }
+            if (!IsEqual(index, key) && (keys.Size() == 0 || compare_(keys[keys.Size() - 1], key))) {
+                keys.EmplaceBack(std::move_if_noexcept(key));
+            }
+        }
+        for (; index < keys_.Size(); ++index) {
+            keys.EmplaceBack(std::move_if_noexcept(keys_[index]));
+        }
+        keys_.Swap(keys);
+        while (pending_.Size() != 0) {
+            pending_.PopBack();
+        }
+    }
+
+    mutable Vector<K> keys_;
+    mutable Vector<K> pending_;
+    [[no_unique_address]] Compare compare_;
+};
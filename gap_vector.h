@@ -0,0 +1,284 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstring>
+#include <span>
+
+//    (gap buffer)  ,   .
+//        :   
+//     O(1),      
+//     .    
+template <typename T>
+class GapVector {
+public:
+    GapVector() = default;
+
+    GapVector(const GapVector& other)
+        : data_(other.Size())
+    {
+        const auto [left, right] = other.Spans();
+        std::uninitialized_copy_n(left.data(), left.size(), data_.GetAddress());
+        try {
+            std::uninitialized_copy_n(right.data(), right.size(), data_.GetAddress() + left.size());
+        }
+        catch (...) {
+            std::destroy_n(data_.GetAddress(), left.size());
+            throw;
+        }
+        gap_begin_ = gap_end_ = other.Size();
+    }
+
+    GapVector(GapVector&& other) noexcept {
+        Swap(other);
+    }
+
+    GapVector& operator=(const GapVector& rhs) {
+        if (this != &rhs) {
+            GapVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    GapVector& operator=(GapVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(GapVector& other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+    }
+
+    ~GapVector() {
+        const auto [left, right] = Spans();
+        std::destroy_n(left.data(), left.size());
+        std::destroy_n(right.data(), right.size());
+    }
+
+    size_t Size() const noexcept {
+        return data_.Capacity() - GapSize();
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    //  :  ,    
+    size_t Cursor() const noexcept {
+        return gap_begin_;
+    }
+
+    //     index.   
+    void MoveCursor(size_t index) {
+        assert(index <= Size());
+        if (GapSize() == 0) {
+            gap_begin_ = gap_end_ = index;
+        }
+        else if (index < gap_begin_) {
+            const size_t count = gap_begin_ - index;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memmove(data_ + (gap_end_ - count), data_ + index, count * sizeof(T));
+                gap_begin_ -= count;
+                gap_end_ -= count;
+            }
+            else {
+                //     ,  
+                //     
+                while (gap_begin_ > index) {
+                    new (data_ + (gap_end_ - 1)) T(std::move(data_[gap_begin_ - 1]));
+                    --gap_end_;
+                    std::destroy_at(data_ + --gap_begin_);
+                }
+            }
+        }
+        else if (index > gap_begin_) {
+            const size_t count = index - gap_begin_;
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memmove(data_ + gap_begin_, data_ + gap_end_, count * sizeof(T));
+                gap_begin_ += count;
+                gap_end_ += count;
+            }
+            else {
+                while (gap_begin_ < index) {
+                    new (data_ + gap_begin_) T(std::move(data_[gap_end_]));
+                    ++gap_begin_;
+                    std::destroy_at(data_ + gap_end_++);
+                }
+            }
+        }
+    }
+
+    //   ,    new_capacity - Size() 
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T> new_data(new_capacity);
+        Relocate(new_data, nullptr);
+    }
+
+    //     index      
+    template <typename... Args>
+    T& Emplace(size_t index, Args&&... args) {
+        assert(index <= Size());
+        T* value_ = nullptr;
+        if (GapSize() == 0) {
+            //     ,     index
+            RawMemory<T> new_data(Capacity() == 0 ? 1 : Capacity() * 2);
+            value_ = new (new_data + index) T(std::forward <Args>(args) ...);
+            Relocate(new_data, value_, index);
+        }
+        else {
+            if (index == gap_begin_) {
+                value_ = new (data_ + gap_begin_) T(std::forward <Args>(args) ...);
+            }
+            else {
+                //     ,   
+                //   
+                T value(std::forward <Args>(args) ...);
+                MoveCursor(index);
+                value_ = new (data_ + gap_begin_) T(std::move(value));
+            }
+        }
+        ++gap_begin_;
+        return *value_;
+    }
+
+    void Insert(size_t index, const T& value) {
+        Emplace(index, value);
+    }
+
+    void Insert(size_t index, T&& value) {
+        Emplace(index, std::move(value));
+    }
+
+    void PushBack(const T& value) {
+        Emplace(Size(), value);
+    }
+
+    void PushBack(T&& value) {
+        Emplace(Size(), std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        return Emplace(Size(), std::forward <Args>(args) ...);
+    }
+
+    //   index,     
+    void Erase(size_t index) {
+        assert(index < Size());
+        if (index < gap_begin_) {
+            MoveCursor(index + 1);
+            std::destroy_at(data_ + --gap_begin_);
+        }
+        else {
+            MoveCursor(index);
+            std::destroy_at(data_ + gap_end_++);
+        }
+    }
+
+    void PopBack() {
+        Erase(Size() - 1);
+    }
+
+    //       -   
+    std::pair<std::span<T>, std::span<T>> Spans() noexcept {
+        return { { data_.GetAddress(), gap_begin_ }, { data_.GetAddress() + gap_end_, Capacity() - gap_end_ } };
+    }
+
+    std::pair<std::span<const T>, std::span<const T>> Spans() const noexcept {
+        const auto [left, right] = const_cast<GapVector&>(*this).Spans();
+        return { left, right };
+    }
+
+    //     Vector   
+    Vector<T> ToVector() const& {
+        Vector<T> result;
+        result.Reserve(Size());
+        const auto [left, right] = Spans();
+        for (const T& value : left) {
+            result.PushBack(value);
+        }
+        for (const T& value : right) {
+            result.PushBack(value);
+        }
+        return result;
+    }
+
+    Vector<T> ToVector() && {
+        Vector<T> result;
+        result.Reserve(Size());
+        const auto [left, right] = Spans();
+        for (T& value : left) {
+            result.PushBack(std::move(value));
+        }
+        for (T& value : right) {
+            result.PushBack(std::move(value));
+        }
+        return result;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<GapVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < Size());
+        return data_[index < gap_begin_ ? index : index + GapSize()];
+    }
+
+private:
+    RawMemory<T> data_;
+    size_t gap_begin_ = 0;
+    size_t gap_end_ = 0;
+
+    size_t GapSize() const noexcept {
+        return gap_end_ - gap_begin_;
+    }
+
+    //    new_data ,     new_gap_begin.
+    //    ,    new_data  emplaced 
+    void Relocate(RawMemory<T>& new_data, T* emplaced, size_t new_gap_begin) {
+        const size_t size = Size();
+        const size_t new_gap_end = new_data.Capacity() - (size - new_gap_begin);
+        //     i       
+        auto target = [&](size_t i) {
+            return new_data + (i < new_gap_begin ? i : i + (new_gap_end - new_gap_begin));
+        };
+        size_t moved = 0;
+        try {
+            for (; moved < size; ++moved) {
+                // constexpr  if     
+                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                    new (target(moved)) T(std::move((*this)[moved]));
+                }
+                else {
+                    new (target(moved)) T((*this)[moved]);
+                }
+            }
+        }
+        catch (...) {
+            for (size_t i = 0; i < moved; ++i) {
+                std::destroy_at(target(i));
+            }
+            if (emplaced != nullptr) {
+                std::destroy_at(emplaced);
+            }
+            throw;
+        }
+        const auto [left, right] = Spans();
+        std::destroy_n(left.data(), left.size());
+        std::destroy_n(right.data(), right.size());
+        data_.Swap(new_data);
+        gap_begin_ = new_gap_begin;
+        gap_end_ = new_gap_end;
+    }
+
+    void Relocate(RawMemory<T>& new_data, T* emplaced) {
+        Relocate(new_data, emplaced, gap_begin_);
+    }
+};
@@ -0,0 +1,344 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+
+//  ,      Vector     
+// 32- .         O(1),
+//        .
+//    ,       
+//  ,   Vector     .
+// Compact     ,       
+template <typename T>
+class IndexList {
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+    //  prev  
+    static constexpr uint32_t FREE_NODE = UINT32_MAX - 1;
+
+    //   ,    .    
+    //      ,  Vector    
+    class Node {
+    public:
+        template <typename... Args>
+        explicit Node(uint32_t prev, uint32_t next, Args&&... args)
+            : prev(prev)
+            , next(next) {
+            new (&value) T(std::forward <Args>(args) ...);
+        }
+
+        Node(const Node& other)
+            : prev(other.prev)
+            , next(other.next) {
+            if (other.IsUsed()) {
+                new (&value) T(other.value);
+            }
+        }
+
+        Node(Node&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : prev(other.prev)
+            , next(other.next) {
+            if (other.IsUsed()) {
+                new (&value) T(std::move(other.value));
+            }
+        }
+
+        Node& operator=(const Node&) = delete;
+        Node& operator=(Node&&) = delete;
+
+        ~Node() {
+            if (IsUsed()) {
+                std::destroy_at(&value);
+            }
+        }
+
+        bool IsUsed() const noexcept {
+            return prev != FREE_NODE;
+        }
+
+        //          free_next
+        void Free(uint32_t free_next) noexcept {
+            std::destroy_at(&value);
+            prev = FREE_NODE;
+            next = free_next;
+        }
+
+        uint32_t prev;
+        uint32_t next;
+        union {
+            T value;
+        };
+    };
+
+public:
+    static constexpr size_t MAX_SIZE = UINT32_MAX - 1;
+
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+        BasicIterator() = default;
+
+        reference operator*() const noexcept {
+            return owner_->nodes_[index_].value;
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        BasicIterator& operator++() noexcept {
+            index_ = owner_->nodes_[index_].next;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            index_ = index_ == NO_NODE ? owner_->tail_ : owner_->nodes_[index_].prev;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        //    ,       Compact
+        uint32_t Index() const noexcept {
+            return index_;
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        operator BasicIterator<true>() const noexcept {
+            return { owner_, index_ };
+        }
+
+    private:
+        friend class IndexList;
+        friend class BasicIterator<!IsConst>;
+        using Owner = std::conditional_t<IsConst, const IndexList, IndexList>;
+
+        BasicIterator(Owner* owner, uint32_t index) noexcept
+            : owner_(owner)
+            , index_(index) {
+        }
+
+        Owner* owner_ = nullptr;
+        uint32_t index_ = NO_NODE;
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    iterator begin() noexcept {
+        return { this, head_ };
+    }
+
+    iterator end() noexcept {
+        return { this, NO_NODE };
+    }
+
+    const_iterator begin() const noexcept {
+        return { this, head_ };
+    }
+
+    const_iterator end() const noexcept {
+        return { this, NO_NODE };
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    IndexList() = default;
+
+    IndexList(const IndexList& other) = default;
+
+    IndexList(IndexList&& other) noexcept {
+        Swap(other);
+    }
+
+    IndexList& operator=(const IndexList& rhs) {
+        if (this != &rhs) {
+            IndexList rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    IndexList& operator=(IndexList&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(IndexList& other) noexcept {
+        nodes_.Swap(other.nodes_);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(free_head_, other.free_head_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    //    ,  
+    size_t Capacity() const noexcept {
+        return nodes_.Capacity();
+    }
+
+    void Reserve(size_t new_capacity) {
+        nodes_.Reserve(new_capacity);
+    }
+
+    T& Front() noexcept {
+        assert(size_ != 0);
+        return nodes_[head_].value;
+    }
+
+    const T& Front() const noexcept {
+        return const_cast<IndexList&>(*this).Front();
+    }
+
+    T& Back() noexcept {
+        assert(size_ != 0);
+        return nodes_[tail_].value;
+    }
+
+    const T& Back() const noexcept {
+        return const_cast<IndexList&>(*this).Back();
+    }
+
+    //    pos
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        const uint32_t next = pos.index_;
+        const uint32_t prev = next == NO_NODE ? tail_ : nodes_[next].prev;
+        const uint32_t index = AllocateNode(prev, next, std::forward <Args>(args) ...);
+        (prev == NO_NODE ? head_ : nodes_[prev].next) = index;
+        (next == NO_NODE ? tail_ : nodes_[next].prev) = index;
+        ++size_;
+        return { this, index };
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        return *Emplace(end(), std::forward <Args>(args) ...);
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceFront(Args&&... args) {
+        return *Emplace(begin(), std::forward <Args>(args) ...);
+    }
+
+    void PushFront(const T& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(T&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    //   pos       
+    iterator Erase(const_iterator pos) noexcept {
+        const uint32_t index = pos.index_;
+        Node& node = nodes_[index];
+        assert(node.IsUsed());
+        const uint32_t prev = node.prev;
+        const uint32_t next = node.next;
+        (prev == NO_NODE ? head_ : nodes_[prev].next) = next;
+        (next == NO_NODE ? tail_ : nodes_[next].prev) = prev;
+        node.Free(free_head_);
+        free_head_ = index;
+        --size_;
+        return { this, next };
+    }
+
+    void PopBack() noexcept {
+        Erase({ this, tail_ });
+    }
+
+    void PopFront() noexcept {
+        Erase({ this, head_ });
+    }
+
+    //           .
+    //      
+    void Compact() {
+        Vector<Node> new_nodes;
+        new_nodes.Reserve(size_);
+        uint32_t index = 0;
+        for (uint32_t i = head_; i != NO_NODE; i = nodes_[i].next, ++index) {
+            new_nodes.EmplaceBack(index == 0 ? NO_NODE : index - 1, index + 1 == size_ ? NO_NODE : index + 1,
+                std::move_if_noexcept(nodes_[i].value));
+        }
+        nodes_.Swap(new_nodes);
+        head_ = size_ == 0 ? NO_NODE : 0;
+        tail_ = size_ == 0 ? NO_NODE : static_cast<uint32_t>(size_ - 1);
+        free_head_ = NO_NODE;
+    }
+
+private:
+    //         
+    template <typename... Args>
+    uint32_t AllocateNode(uint32_t prev, uint32_t next, Args&&... args) {
+        if (free_head_ != NO_NODE) {
+            const uint32_t index = free_head_;
+            Node& node = nodes_[index];
+            const uint32_t free_next = node.next;
+            new (&node.value) T(std::forward <Args>(args) ...);
+            node.prev = prev;
+            node.next = next;
+            free_head_ = free_next;
+            return index;
+        }
+        if (nodes_.Size() == MAX_SIZE) {
+            throw std::length_error("IndexList size exceeds 2^32 - 2 elements");
+        }
+        nodes_.EmplaceBack(prev, next, std::forward <Args>(args) ...);
+        return static_cast<uint32_t>(nodes_.Size() - 1);
+    }
+
+    Vector<Node> nodes_;
+    uint32_t head_ = NO_NODE;
+    uint32_t tail_ = NO_NODE;
+    uint32_t free_head_ = NO_NODE;
+    size_t size_ = 0;
+};
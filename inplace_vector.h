@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//    N    .    ,
+//      .    Try 
+// std::length_error    , Try-     nullptr.
+//  T  , InplaceVector     
+//     
+template <typename T, size_t N>
+class InplaceVector {
+    static_assert(N > 0, "InplaceVector capacity must be positive");
+    static constexpr bool TRIVIAL = std::is_trivially_copyable_v<T>;
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    InplaceVector() = default;
+
+    explicit InplaceVector(size_t size) {
+        Resize(size);
+    }
+
+    InplaceVector(const InplaceVector& other) requires TRIVIAL = default;
+
+    InplaceVector(const InplaceVector& other) {
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    InplaceVector(InplaceVector&& other) requires TRIVIAL = default;
+
+    //  other  ,  other  
+    InplaceVector(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    InplaceVector& operator=(const InplaceVector& rhs) requires TRIVIAL = default;
+
+    InplaceVector& operator=(const InplaceVector& rhs) {
+        if (this != &rhs) {
+            Assign(rhs.Data(), rhs.size_, [](const T& value) -> const T& { return value; });
+        }
+        return *this;
+    }
+
+    InplaceVector& operator=(InplaceVector&& rhs) requires TRIVIAL = default;
+
+    InplaceVector& operator=(InplaceVector&& rhs) noexcept(std::is_nothrow_move_assignable_v<T>
+        && std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            Assign(rhs.Data(), rhs.size_, [](T& value) -> T&& { return std::move(value); });
+        }
+        return *this;
+    }
+
+    ~InplaceVector() requires TRIVIAL = default;
+
+    ~InplaceVector() {
+        std::destroy_n(Data(), size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size > N) {
+            throw std::length_error("InplaceVector capacity exceeded");
+        }
+        if (new_size < size_) {
+            std::destroy_n(Data() + new_size, size_ - new_size);
+        }
+        else {
+            std::uninitialized_value_construct_n(Data() + size_, new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (T* value = TryEmplaceBack(std::forward <Args>(args) ...)) {
+            return *value;
+        }
+        throw std::length_error("InplaceVector capacity exceeded");
+    }
+
+    //  nullptr,   
+    template <typename... Args>
+    T* TryEmplaceBack(Args&&... args) {
+        if (size_ == N) {
+            return nullptr;
+        }
+        T* value = new (Data() + size_) T(std::forward <Args>(args) ...);
+        ++size_;
+        return value;
+    }
+
+    T* TryPushBack(const T& value) {
+        return TryEmplaceBack(value);
+    }
+
+    T* TryPushBack(T&& value) {
+        return TryEmplaceBack(std::move(value));
+    }
+
+    void PopBack() noexcept {
+        assert(size_ != 0);
+        std::destroy_at(end() - 1);
+        --size_;
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        if (iterator value = TryEmplace(pos, std::forward <Args>(args) ...)) {
+            return value;
+        }
+        throw std::length_error("InplaceVector capacity exceeded");
+    }
+
+    //  nullptr,   
+    template <typename... Args>
+    iterator TryEmplace(const_iterator pos, Args&&... args) {
+        if (size_ == N) {
+            return nullptr;
+        }
+        iterator pos_ = const_cast<iterator>(pos);
+        if (pos_ == end()) {
+            return TryEmplaceBack(std::forward <Args>(args) ...);
+        }
+        //      ,     
+        T value(std::forward <Args>(args) ...);
+        new (end()) T(std::move(*(end() - 1)));
+        ++size_;
+        std::move_backward(pos_, end() - 2, end() - 1);
+        *pos_ = std::move(value);
+        return pos_;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    iterator TryInsert(const_iterator pos, const T& value) {
+        return TryEmplace(pos, value);
+    }
+
+    iterator TryInsert(const_iterator pos, T&& value) {
+        return TryEmplace(pos, std::move(value));
+    }
+
+    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        iterator pos_ = const_cast<iterator>(pos);
+        std::move(pos_ + 1, end(), pos_);
+        PopBack();
+        return pos_;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<InplaceVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+private:
+    T* Data() noexcept {
+        return std::launder(reinterpret_cast<T*>(storage_));
+    }
+
+    const T* Data() const noexcept {
+        return const_cast<InplaceVector&>(*this).Data();
+    }
+
+    //   [source, source + size), cast    
+    template <typename Source, typename Cast>
+    void Assign(Source* source, size_t size, Cast cast) {
+        const size_t common = std::min(size, size_);
+        for (size_t i = 0; i < common; ++i) {
+            Data()[i] = cast(source[i]);
+        }
+        if (size < size_) {
+            std::destroy_n(Data() + size, size_ - size);
+            size_ = size;
+        }
+        for (; size_ < size; ++size_) {
+            new (Data() + size_) T(cast(source[size_]));
+        }
+    }
+
+    alignas(T) unsigned char storage_[sizeof(T) * N];
+    size_t size_ = 0;
+};
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "string_vector.h"
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+
+//    (string interning).      32-
+//    ,         .
+//      StringVector,       O(1).
+//       -      :
+// Vector<uint32_t>    ,    .
+//    ,       
+//       
+class InternPool {
+public:
+    static constexpr uint32_t NO_ID = UINT32_MAX;
+    static constexpr size_t MIN_TABLE_SIZE = 16;
+    //     InternBatch     
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+
+    //   
+    size_t Size() const noexcept {
+        return strings_.Size();
+    }
+
+    //      
+    size_t CharCount() const noexcept {
+        return strings_.CharCount();
+    }
+
+    void Reserve(size_t string_capacity, size_t char_capacity) {
+        strings_.Reserve(string_capacity, char_capacity);
+        hashes_.Reserve(string_capacity);
+        if (string_capacity * 2 > table_.Size()) {
+            Rehash(TableSizeFor(string_capacity));
+        }
+    }
+
+    std::string_view operator[](uint32_t id) const noexcept {
+        return strings_[id];
+    }
+
+    //   value,       
+    uint32_t Intern(std::string_view value) {
+        return Intern(value, Hash(value));
+    }
+
+    //   value  NO_ID,     
+    uint32_t Find(std::string_view value) const noexcept {
+        if (table_.Size() == 0) {
+            return NO_ID;
+        }
+        const uint32_t hash = Hash(value);
+        return table_[FindSlot(value, hash)];
+    }
+
+    //      strings  .   ,
+    //         ,   
+    template <typename Strings>
+    Vector<uint32_t> InternBatch(const Strings& strings) {
+        Vector<uint32_t> hashes;
+        for (const auto& value : strings) {
+            hashes.PushBack(Hash(value));
+        }
+        Vector<uint32_t> ids;
+        ids.Reserve(hashes.Size());
+        size_t i = 0;
+        for (const auto& value : strings) {
+            if (i + PREFETCH_DISTANCE < hashes.Size() && table_.Size() != 0) {
+                Prefetch(&table_[hashes[i + PREFETCH_DISTANCE] & (table_.Size() - 1)]);
+            }
+            ids.PushBack(Intern(value, hashes[i]));
+            ++i;
+        }
+        return ids;
+    }
+
+private:
+    static uint32_t Hash(std::string_view value) noexcept {
+        //  uint64_t     32- size_t
+        const uint64_t hash = std::hash<std::string_view>()(value);
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+    static void Prefetch([[maybe_unused]] const void* address) noexcept {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    //   -  ,     
+    static size_t TableSizeFor(size_t count) noexcept {
+        size_t size = MIN_TABLE_SIZE;
+        while (size < count * 2) {
+            size *= 2;
+        }
+        return size;
+    }
+
+    //    value   ,     
+    size_t FindSlot(std::string_view value, uint32_t hash) const noexcept {
+        const size_t mask = table_.Size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            const uint32_t id = table_[slot];
+            if (id == NO_ID || (hashes_[id] == hash && strings_[id] == value)) {
+                return slot;
+            }
+        }
+    }
+
+    uint32_t Intern(std::string_view value, uint32_t hash) {
+        if (table_.Size() == 0) {
+            Rehash(MIN_TABLE_SIZE);
+        }
+        size_t slot = FindSlot(value, hash);
+        if (table_[slot] != NO_ID) {
+            return table_[slot];
+        }
+        if (Size() == NO_ID) {
+            throw std::length_error("InternPool size exceeds 2^32 - 1 strings");
+        }
+        if ((Size() + 1) * 2 > table_.Size()) {
+            Rehash(table_.Size() * 2);
+            slot = FindSlot(value, hash);
+        }
+        hashes_.PushBack(hash);
+        try {
+            strings_.PushBack(value);
+        }
+        catch (...) {
+            hashes_.PopBack();
+            throw;
+        }
+        const uint32_t id = static_cast<uint32_t>(Size() - 1);
+        table_[slot] = id;
+        return id;
+    }
+
+    void Rehash(size_t table_size) {
+        Vector<uint32_t> table(table_size);
+        std::fill(table.begin(), table.end(), NO_ID);
+        const size_t mask = table_size - 1;
+        for (uint32_t id = 0; id < Size(); ++id) {
+            size_t slot = hashes_[id] & mask;
+            while (table[slot] != NO_ID) {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = id;
+        }
+        table_.Swap(table);
+    }
+
+    StringVector strings_;
+    Vector<uint32_t> hashes_;
+    Vector<uint32_t> table_;
+};
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+//       CSR (compressed sparse row):  
+//     Vector<T>,        Offset -
+//  row  [begins_[row], ends_[row]).     CSR   
+//  n + 1 ,     :      
+//  ,   .
+//    Compact      (ends_[row] == begins_[row + 1]),
+//     -     . Offset - uint32_t  uint64_t,
+//    .
+//    :        , 
+//     ,         Compact
+template <typename T, typename Offset = uint32_t>
+class JaggedVector {
+    static_assert(std::is_unsigned_v<Offset>, "Offset must be an unsigned integer type");
+
+public:
+    JaggedVector() = default;
+
+    //  row_count    (, )  .
+    //     ,     pairs
+    template <typename Pairs>
+    static JaggedVector FromPairs(size_t row_count, const Pairs& pairs) {
+        JaggedVector result;
+        result.begins_.Resize(row_count);
+        result.ends_.Resize(row_count);
+        size_t size = 0;
+        for (const auto& [row, value] : pairs) {
+            assert(static_cast<size_t>(row) < row_count);
+            ++result.ends_[row];
+            ++size;
+        }
+        CheckSize(size);
+        Offset offset = 0;
+        for (size_t row = 0; row < row_count; ++row) {
+            result.begins_[row] = offset;
+            offset += result.ends_[row];
+            result.ends_[row] = result.begins_[row];
+        }
+        if constexpr (std::is_default_constructible_v<T> && std::is_copy_assignable_v<T>) {
+            result.values_.Resize(size);
+            for (const auto& pair : pairs) {
+                result.values_[result.ends_[pair.first]++] = pair.second;
+            }
+        }
+        else {
+            //    ,      
+            Vector<decltype(&*std::begin(pairs))> order(size);
+            for (const auto& pair : pairs) {
+                order[result.ends_[pair.first]++] = &pair;
+            }
+            result.values_.Reserve(size);
+            for (const auto* pair : order) {
+                result.values_.EmplaceBack(pair->second);
+            }
+        }
+        return result;
+    }
+
+    size_t RowCount() const noexcept {
+        return begins_.Size();
+    }
+
+    //     
+    size_t Size() const noexcept {
+        return values_.Size() - garbage_;
+    }
+
+    //  ,       Compact
+    size_t Garbage() const noexcept {
+        return garbage_;
+    }
+
+    size_t RowSize(size_t row) const noexcept {
+        assert(row < RowCount());
+        return ends_[row] - begins_[row];
+    }
+
+    std::span<T> operator[](size_t row) noexcept {
+        assert(row < RowCount());
+        //        ,     
+        if (begins_[row] == ends_[row]) {
+            return {};
+        }
+        return { values_.begin() + begins_[row], RowSize(row) };
+    }
+
+    std::span<const T> operator[](size_t row) const noexcept {
+        return const_cast<JaggedVector&>(*this)[row];
+    }
+
+    void Reserve(size_t row_capacity, size_t value_capacity) {
+        begins_.Reserve(row_capacity);
+        ends_.Reserve(row_capacity);
+        values_.Reserve(value_capacity);
+    }
+
+    //      row    
+    size_t AppendRow(std::span<const T> row) {
+        //       JaggedVector,  Grow    
+        //  ,        Vector
+        if (!row.empty() && !std::less<const T*>()(row.data(), values_.begin())
+            && std::less<const T*>()(row.data(), values_.end())) {
+            Vector<T> copy;
+            copy.Reserve(row.size());
+            for (const T& value : row) {
+                copy.PushBack(value);
+            }
+            return AppendRow(std::span<const T>(copy.begin(), copy.Size()));
+        }
+        const size_t old_size = values_.Size();
+        Grow(row.size());
+        try {
+            for (const T& value : row) {
+                values_.PushBack(value);
+            }
+        }
+        catch (...) {
+            Truncate(old_size);
+            throw;
+        }
+        const Offset begin = static_cast<Offset>(old_size);
+        const Offset end = static_cast<Offset>(values_.Size());
+        begins_.PushBack(begin);
+        try {
+            ends_.PushBack(end);
+        }
+        catch (...) {
+            begins_.PopBack();
+            throw;
+        }
+        return RowCount() - 1;
+    }
+
+    size_t AppendRow(std::initializer_list<T> row) {
+        return AppendRow(std::span<const T>(row.begin(), row.size()));
+    }
+
+    size_t AppendRow() {
+        return AppendRow(std::span<const T>());
+    }
+
+    //      row. ,    
+    //   ,     .
+    //        JaggedVector
+    template <typename... Args>
+    T& EmplaceBack(size_t row, Args&&... args) {
+        assert(row < RowCount());
+        if (ends_[row] == values_.Size()) {
+            CheckSize(values_.Size() + 1);
+            // Vector::EmplaceBack     ,    args 
+            T& value = values_.EmplaceBack(std::forward <Args>(args) ...);
+            ++ends_[row];
+            return value;
+        }
+        //    Grow  ,     args,
+        //     
+        T new_value(std::forward <Args>(args) ...);
+        const size_t old_size = values_.Size();
+        const size_t old_begin = begins_[row];
+        const size_t row_size = RowSize(row);
+        Grow(row_size + 1);
+        try {
+            for (size_t i = 0; i < row_size; ++i) {
+                values_.EmplaceBack(std::move_if_noexcept(values_[old_begin + i]));
+            }
+            values_.EmplaceBack(std::move_if_noexcept(new_value));
+        }
+        catch (...) {
+            Truncate(old_size);
+            throw;
+        }
+        begins_[row] = static_cast<Offset>(old_size);
+        ends_[row] = static_cast<Offset>(values_.Size());
+        garbage_ += row_size;
+        return values_[values_.Size() - 1];
+    }
+
+    void PushBack(size_t row, const T& value) {
+        EmplaceBack(row, value);
+    }
+
+    void PushBack(size_t row, T&& value) {
+        EmplaceBack(row, std::move(value));
+    }
+
+    //   index   row,     
+    void Erase(size_t row, size_t index) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        assert(index < RowSize(row));
+        T* first = values_.begin() + begins_[row];
+        std::move(first + index + 1, first + RowSize(row), first + index);
+        --ends_[row];
+        if (ends_[row] + 1 == values_.Size()) {
+            values_.PopBack();
+        }
+        else {
+            ++garbage_;
+        }
+    }
+
+    //      ,   
+    void Compact() {
+        if (garbage_ == 0 && IsOrdered()) {
+            return;
+        }
+        Vector<T> new_values;
+        new_values.Reserve(Size());
+        for (size_t row = 0; row < RowCount(); ++row) {
+            for (size_t i = begins_[row]; i < ends_[row]; ++i) {
+                new_values.EmplaceBack(std::move_if_noexcept(values_[i]));
+            }
+        }
+        Offset offset = 0;
+        for (size_t row = 0; row < RowCount(); ++row) {
+            const Offset row_size = ends_[row] - begins_[row];
+            begins_[row] = offset;
+            offset += row_size;
+            ends_[row] = offset;
+        }
+        values_.Swap(new_values);
+        garbage_ = 0;
+    }
+
+private:
+    static void CheckSize(size_t size) {
+        if (size > std::numeric_limits<Offset>::max()) {
+            throw std::length_error("JaggedVector size exceeds the Offset range");
+        }
+    }
+
+    //    extra ,      
+    void Grow(size_t extra) {
+        const size_t new_size = values_.Size() + extra;
+        CheckSize(new_size);
+        if (new_size > values_.Capacity()) {
+            values_.Reserve(std::max(values_.Size() * 2, new_size));
+        }
+    }
+
+    //  ,     old_size
+    void Truncate(size_t old_size) noexcept {
+        while (values_.Size() > old_size) {
+            values_.PopBack();
+        }
+    }
+
+    //     
+    bool IsOrdered() const noexcept {
+        for (size_t row = 0; row + 1 < RowCount(); ++row) {
+            if (ends_[row] != begins_[row + 1]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Vector<T> values_;
+    Vector<Offset> begins_;
+    Vector<Offset> ends_;
+    size_t garbage_ = 0;
+};
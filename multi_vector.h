@@ -0,0 +1,339 @@
+#pragma once
+
+#include "vector.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <tuple>
+
+//     ,  , 
+//   .       RawMemory   ,
+//           .
+//   -  ,    -
+//   alignof   ,   .
+//          ,  
+//      .    
+//     :       ,
+//  ,     ,    
+template <typename... Ts>
+class MultiVector {
+public:
+    static_assert(sizeof...(Ts) > 0, "MultiVector needs at least one column");
+
+    static constexpr size_t COLUMN_COUNT = sizeof...(Ts);
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    //      
+    static constexpr size_t ALIGNMENT = std::max({ CACHE_LINE_SIZE, alignof(Ts)... });
+
+    template <size_t I>
+    using ColumnType = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    MultiVector() = default;
+
+    explicit MultiVector(size_t size)
+        : MultiVector(Allocation{ size }) {
+        ForEachColumn([this, size](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            try {
+                std::uninitialized_value_construct_n(std::get<I>(columns_), size);
+            }
+            catch (...) {
+                DestroyColumns(columns_, I, size);
+                throw;
+            }
+            });
+        size_ = size;
+    }
+
+    MultiVector(const MultiVector& other)
+        : MultiVector(Allocation{ other.size_ }) {
+        ForEachColumn([this, &other](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            try {
+                std::uninitialized_copy_n(std::get<I>(other.columns_), other.size_, std::get<I>(columns_));
+            }
+            catch (...) {
+                DestroyColumns(columns_, I, other.size_);
+                throw;
+            }
+            });
+        size_ = other.size_;
+    }
+
+    MultiVector(MultiVector&& other) noexcept {
+        Swap(other);
+    }
+
+    MultiVector& operator=(const MultiVector& rhs) {
+        if (this != &rhs) {
+            MultiVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    MultiVector& operator=(MultiVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(MultiVector& other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    ~MultiVector() {
+        DestroyColumns(columns_, COLUMN_COUNT, size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    //   I- 
+    template <size_t I>
+    std::span<ColumnType<I>> Column() noexcept {
+        return { std::get<I>(columns_), size_ };
+    }
+
+    template <size_t I>
+    std::span<const ColumnType<I>> Column() const noexcept {
+        return { std::get<I>(columns_), size_ };
+    }
+
+    template <size_t I>
+    ColumnType<I>& Get(size_t index) noexcept {
+        assert(index < size_);
+        return std::get<I>(columns_)[index];
+    }
+
+    template <size_t I>
+    const ColumnType<I>& Get(size_t index) const noexcept {
+        return const_cast<MultiVector&>(*this).template Get<I>(index);
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        MultiVector new_data(Allocation{ new_capacity });
+
+        MoveOrCopyData(new_data);
+
+        Replace(new_data);
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            ForEachColumn([this, new_size](auto index) {
+                std::destroy_n(std::get<decltype(index)::value>(columns_) + new_size, size_ - new_size);
+                });
+        }
+        else {
+            Reserve(new_size);
+            ForEachColumn([this, new_size](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                try {
+                    std::uninitialized_value_construct_n(std::get<I>(columns_) + size_, new_size - size_);
+                }
+                catch (...) {
+                    DestroyColumns(columns_, I, new_size - size_, size_);
+                    throw;
+                }
+                });
+        }
+        size_ = new_size;
+    }
+
+    //  ,      
+    template <typename... Args>
+    void EmplaceBack(Args&&... values) {
+        static_assert(sizeof...(Args) == COLUMN_COUNT, "EmplaceBack expects one value per column");
+        if (size_ == capacity_) {
+            //       ,     
+            //   
+            MultiVector new_data(Allocation{ size_ == 0 ? 1 : size_ * 2 });
+            new_data.ConstructRow(size_, std::index_sequence_for<Ts...>{}, std::forward<Args>(values)...);
+            try {
+                MoveOrCopyData(new_data);
+            }
+            catch (...) {
+                DestroyColumns(new_data.columns_, COLUMN_COUNT, 1, size_);
+                throw;
+            }
+            Replace(new_data);
+        }
+        else {
+            ConstructRow(size_, std::index_sequence_for<Ts...>{}, std::forward<Args>(values)...);
+        }
+        ++size_;
+    }
+
+    void PushBack(const Ts&... values) {
+        EmplaceBack(values...);
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        DestroyColumns(columns_, COLUMN_COUNT, 1, size_);
+    }
+
+    //     index,    
+    template <typename... Args>
+    void Emplace(size_t index, Args&&... values) {
+        static_assert(sizeof...(Args) == COLUMN_COUNT, "Emplace expects one value per column");
+        assert(index <= size_);
+        if (index == size_) {
+            EmplaceBack(std::forward<Args>(values)...);
+            return;
+        }
+        //      ,    
+        std::tuple<Ts...> row(std::forward<Args>(values)...);
+        if (size_ == capacity_) {
+            Reserve(size_ * 2);
+        }
+        MoveLastRowToEnd(std::index_sequence_for<Ts...>{});
+        ++size_;
+        ForEachColumn([this, index, &row](auto column) {
+            constexpr size_t I = decltype(column)::value;
+            ColumnType<I>* data = std::get<I>(columns_);
+            std::move_backward(data + index, data + size_ - 2, data + size_ - 1);
+            data[index] = std::move(std::get<I>(row));
+            });
+    }
+
+    void Insert(size_t index, const Ts&... values) {
+        Emplace(index, values...);
+    }
+
+    //   index,    
+    void Erase(size_t index) noexcept((std::is_nothrow_move_assignable_v<Ts> && ...)) {
+        assert(index < size_);
+        ForEachColumn([this, index](auto column) {
+            ColumnType<decltype(column)::value>* data = std::get<decltype(column)::value>(columns_);
+            std::move(data + index + 1, data + size_, data + index);
+            });
+        PopBack();
+    }
+
+private:
+    using Block = RawMemory<std::byte, PagePolicy<>, ALIGNMENT>;
+
+    static constexpr bool NOTHROW_RELOCATABLE =
+        ((std::is_nothrow_move_constructible_v<Ts> || !std::is_copy_constructible_v<Ts>) && ...);
+
+    Block data_;
+    std::tuple<Ts*...> columns_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+
+    struct Allocation {
+        size_t capacity;
+    };
+
+    //    capacity      
+    explicit MultiVector(Allocation allocation) {
+        const size_t capacity = allocation.capacity;
+        if (capacity == 0) {
+            return;
+        }
+        const std::array<size_t, COLUMN_COUNT + 1> offsets = ColumnOffsets(capacity);
+        Block data(offsets[COLUMN_COUNT]);
+        ForEachColumn([&](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            std::get<I>(columns_) = reinterpret_cast<ColumnType<I>*>(data.GetAddress() + offsets[I]);
+            });
+        data_.Swap(data);
+        capacity_ = capacity;
+    }
+
+    static constexpr size_t RoundUp(size_t value, size_t alignment) noexcept {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    //     .   -   
+    static std::array<size_t, COLUMN_COUNT + 1> ColumnOffsets(size_t capacity) noexcept {
+        constexpr std::array<size_t, COLUMN_COUNT> sizes = { sizeof(Ts)... };
+        std::array<size_t, COLUMN_COUNT + 1> offsets{};
+        for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+            offsets[i + 1] = RoundUp(offsets[i] + capacity * sizes[i], ALIGNMENT);
+        }
+        return offsets;
+    }
+
+    template <typename F>
+    static void ForEachColumn(F&& f) {
+        ForEachColumnImpl(f, std::index_sequence_for<Ts...>{});
+    }
+
+    template <typename F, size_t... Is>
+    static void ForEachColumnImpl(F& f, std::index_sequence<Is...>) {
+        (f(std::integral_constant<size_t, Is>{}), ...);
+    }
+
+    //  count    first   column_count 
+    static void DestroyColumns(const std::tuple<Ts*...>& columns, size_t column_count, size_t count, size_t first = 0) noexcept {
+        ForEachColumn([&](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            if (I < column_count) {
+                std::destroy_n(std::get<I>(columns) + first, count);
+            }
+            });
+    }
+
+    template <size_t... Is, typename... Args>
+    void ConstructRow(size_t row, std::index_sequence<Is...>, Args&&... values) {
+        size_t constructed = 0;
+        try {
+            ((new (std::get<Is>(columns_) + row) Ts(std::forward<Args>(values)), ++constructed), ...);
+        }
+        catch (...) {
+            DestroyColumns(columns_, constructed, 1, row);
+            throw;
+        }
+    }
+
+    template <size_t... Is>
+    void MoveLastRowToEnd(std::index_sequence<Is...> columns) {
+        ConstructRow(size_, columns, std::move(std::get<Is>(columns_)[size_ - 1])...);
+    }
+
+    //    ,    new_data,    
+    void Replace(MultiVector& new_data) noexcept {
+        DestroyColumns(columns_, COLUMN_COUNT, size_);
+        new_data.size_ = std::exchange(size_, 0);
+        Swap(new_data);
+    }
+
+    void MoveOrCopyData(MultiVector& new_data) {
+        ForEachColumn([this, &new_data](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            using T = ColumnType<I>;
+            //  ,          ,
+            //       .  
+            //   ,      
+            try {
+                if constexpr (NOTHROW_RELOCATABLE || !std::is_copy_constructible_v<T>) {
+                    std::uninitialized_move_n(std::get<I>(columns_), size_, std::get<I>(new_data.columns_));
+                }
+                else {
+                    std::uninitialized_copy_n(std::get<I>(columns_), size_, std::get<I>(new_data.columns_));
+                }
+            }
+            catch (...) {
+                //     .   ,  ,
+                //     
+                DestroyColumns(new_data.columns_, I, size_);
+                throw;
+            }
+            });
+    }
+};
@@ -0,0 +1,480 @@
+#pragma once
+
+#include "vector.h"
+
+#include <memory>
+
+//     RRB- (relaxed radix balanced tree)   32.
+//     ,      ,
+//   ()  O(1),  PushBack, Set, Slice  Concat - O(log32 n) .
+//      ,    ,  
+//     .
+//     :   ,  , 
+// ,     . ,   Slice  Concat,
+//      
+template <typename T>
+class PersistentVector {
+public:
+    static constexpr size_t BITS = 5;
+    static constexpr size_t BRANCHING = size_t{ 1 } << BITS;
+
+    class Builder;
+
+    PersistentVector() = default;
+
+    //     values  O(n)
+    static PersistentVector FromVector(const Vector<T>& values) {
+        Builder builder;
+        for (const T& value : values) {
+            builder.PushBack(value);
+        }
+        return std::move(builder).Build();
+    }
+
+    static PersistentVector FromVector(Vector<T>&& values) {
+        Builder builder;
+        for (T& value : values) {
+            builder.PushBack(std::move(value));
+        }
+        return std::move(builder).Build();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        const Node* node = root_.get();
+        for (size_t shift = shift_; shift > 0; shift -= BITS) {
+            const auto [child, start] = Locate(*node, shift, index);
+            index -= start;
+            node = node->children[child].get();
+        }
+        return node->values[index];
+    }
+
+    //   value,   
+    [[nodiscard]] PersistentVector PushBack(T value) const {
+        PersistentVector result(*this);
+        if (root_ == nullptr) {
+            result.root_ = NewPath(0, std::move(value));
+        }
+        else if (NodePtr root = Append(*root_, shift_, value)) {
+            result.root_ = std::move(root);
+        }
+        else {
+            Vector<NodePtr> children;
+            children.PushBack(root_);
+            children.PushBack(NewPath(shift_, std::move(value)));
+            result.root_ = MakeInternal(std::move(children), shift_ + BITS);
+            result.shift_ += BITS;
+        }
+        ++result.size_;
+        return result;
+    }
+
+    // ,    index   value
+    [[nodiscard]] PersistentVector Set(size_t index, T value) const {
+        assert(index < size_);
+        PersistentVector result(*this);
+        result.root_ = Update(*root_, shift_, index, std::move(value));
+        return result;
+    }
+
+    //    [begin, end)
+    [[nodiscard]] PersistentVector Slice(size_t begin, size_t end) const {
+        assert(begin <= end && end <= size_);
+        if (begin == end) {
+            return {};
+        }
+        PersistentVector result(*this);
+        if (end < size_) {
+            result.root_ = Take(*result.root_, result.shift_, end);
+        }
+        if (begin > 0) {
+            result.root_ = Drop(*result.root_, result.shift_, begin);
+        }
+        result.size_ = end - begin;
+        result.CollapseRoot();
+        return result;
+    }
+
+    //    *this,     other
+    [[nodiscard]] PersistentVector Concat(const PersistentVector& other) const {
+        if (other.size_ == 0) {
+            return *this;
+        }
+        if (size_ == 0) {
+            return other;
+        }
+        PersistentVector result;
+        Vector<NodePtr> nodes;
+        if (shift_ >= other.shift_) {
+            nodes = MergeRight(root_, shift_, other.root_, other.shift_);
+            result.shift_ = shift_;
+        }
+        else {
+            nodes = MergeLeft(root_, shift_, other.root_, other.shift_);
+            result.shift_ = other.shift_;
+        }
+        if (nodes.Size() == 1) {
+            result.root_ = nodes[0];
+        }
+        else {
+            result.root_ = MakeInternal(std::move(nodes), result.shift_ + BITS);
+            result.shift_ += BITS;
+        }
+        result.size_ = size_ + other.size_;
+        return result;
+    }
+
+    //  func     
+    template <typename Func>
+    void ForEach(Func&& func) const {
+        if (root_ != nullptr) {
+            ForEachInNode(*root_, shift_, func);
+        }
+    }
+
+    Vector<T> ToVector() const {
+        Vector<T> result;
+        result.Reserve(size_);
+        ForEach([&result](const T& value) {
+            result.PushBack(value);
+            });
+        return result;
+    }
+
+private:
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    struct Node {
+        Vector<T> values;          //  
+        Vector<NodePtr> children;  //   
+        Vector<size_t> sizes;      //   ,    
+    };
+
+    NodePtr root_;
+    //    : 0,   - 
+    size_t shift_ = 0;
+    size_t size_ = 0;
+
+    static size_t NodeSize(const Node& node, size_t shift) noexcept {
+        if (shift == 0) {
+            return node.values.Size();
+        }
+        if (node.sizes.Size() != 0) {
+            return node.sizes[node.sizes.Size() - 1];
+        }
+        const size_t last = node.children.Size() - 1;
+        return (last << shift) + NodeSize(*node.children[last], shift - BITS);
+    }
+
+    //  ,   index,      
+    static std::pair<size_t, size_t> Locate(const Node& node, size_t shift, size_t index) noexcept {
+        size_t child = index >> shift;
+        if (node.sizes.Size() == 0) {
+            return { child, child << shift };
+        }
+        //      2^shift ,     
+        while (node.sizes[child] <= index) {
+            ++child;
+        }
+        return { child, child == 0 ? 0 : node.sizes[child - 1] };
+    }
+
+    static NodePtr MakeLeaf(Vector<T>&& values) {
+        auto node = std::make_shared<Node>();
+        node->values = std::move(values);
+        return node;
+    }
+
+    //     shift.   ,  
+    // - ,  ,   
+    static NodePtr MakeInternal(Vector<NodePtr>&& children, size_t shift) {
+        assert(children.Size() > 0 && children.Size() <= BRANCHING);
+        auto node = std::make_shared<Node>();
+        const size_t child_shift = shift - BITS;
+        const size_t full_size = size_t{ 1 } << shift;
+        bool balanced = true;
+        Vector<size_t> sizes;
+        sizes.Reserve(children.Size());
+        size_t total = 0;
+        for (size_t i = 0; i < children.Size(); ++i) {
+            const size_t child_size = NodeSize(*children[i], child_shift);
+            balanced = balanced && (i + 1 == children.Size() || child_size == full_size);
+            total += child_size;
+            sizes.PushBack(total);
+        }
+        if (!balanced) {
+            node->sizes = std::move(sizes);
+        }
+        node->children = std::move(children);
+        return node;
+    }
+
+    //     shift      value
+    static NodePtr NewPath(size_t shift, T&& value) {
+        Vector<T> values;
+        values.PushBack(std::move(value));
+        NodePtr node = MakeLeaf(std::move(values));
+        for (size_t level = BITS; level <= shift; level += BITS) {
+            Vector<NodePtr> children;
+            children.PushBack(std::move(node));
+            node = MakeInternal(std::move(children), level);
+        }
+        return node;
+    }
+
+    //  node  value    nullptr,     
+    static NodePtr Append(const Node& node, size_t shift, T& value) {
+        if (shift == 0) {
+            if (node.values.Size() == BRANCHING) {
+                return nullptr;
+            }
+            Vector<T> values(node.values);
+            values.PushBack(std::move(value));
+            return MakeLeaf(std::move(values));
+        }
+        const size_t last = node.children.Size() - 1;
+        Vector<NodePtr> children(node.children);
+        if (NodePtr child = Append(*node.children[last], shift - BITS, value)) {
+            children[last] = std::move(child);
+        }
+        else if (children.Size() < BRANCHING) {
+            children.PushBack(NewPath(shift - BITS, std::move(value)));
+        }
+        else {
+            return nullptr;
+        }
+        return MakeInternal(std::move(children), shift);
+    }
+
+    static NodePtr Update(const Node& node, size_t shift, size_t index, T&& value) {
+        if (shift == 0) {
+            Vector<T> values(node.values);
+            values[index] = std::move(value);
+            return MakeLeaf(std::move(values));
+        }
+        const auto [child, start] = Locate(node, shift, index);
+        auto copy = std::make_shared<Node>(node);
+        copy->children[child] = Update(*node.children[child], shift - BITS, index - start, std::move(value));
+        return copy;
+    }
+
+    //  count  
+    static NodePtr Take(const Node& node, size_t shift, size_t count) {
+        if (shift == 0) {
+            Vector<T> values;
+            values.Reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                values.PushBack(node.values[i]);
+            }
+            return MakeLeaf(std::move(values));
+        }
+        const auto [child, start] = Locate(node, shift, count - 1);
+        Vector<NodePtr> children;
+        children.Reserve(child + 1);
+        for (size_t i = 0; i < child; ++i) {
+            children.PushBack(node.children[i]);
+        }
+        children.PushBack(Take(*node.children[child], shift - BITS, count - start));
+        return MakeInternal(std::move(children), shift);
+    }
+
+    //    count 
+    static NodePtr Drop(const Node& node, size_t shift, size_t count) {
+        if (shift == 0) {
+            Vector<T> values;
+            values.Reserve(node.values.Size() - count);
+            for (size_t i = count; i < node.values.Size(); ++i) {
+                values.PushBack(node.values[i]);
+            }
+            return MakeLeaf(std::move(values));
+        }
+        const auto [child, start] = Locate(node, shift, count);
+        Vector<NodePtr> children;
+        children.Reserve(node.children.Size() - child);
+        children.PushBack(count == start ? node.children[child] : Drop(*node.children[child], shift - BITS, count - start));
+        for (size_t i = child + 1; i < node.children.Size(); ++i) {
+            children.PushBack(node.children[i]);
+        }
+        return MakeInternal(std::move(children), shift);
+    }
+
+    //     ,   Slice
+    void CollapseRoot() {
+        while (shift_ > 0 && root_->children.Size() == 1) {
+            NodePtr child = root_->children[0];
+            root_ = std::move(child);
+            shift_ -= BITS;
+        }
+    }
+
+    //   2 * BRANCHING        shift
+    static Vector<NodePtr> Split(Vector<NodePtr>&& children, size_t shift) {
+        Vector<NodePtr> result;
+        if (children.Size() <= BRANCHING) {
+            result.PushBack(MakeInternal(std::move(children), shift));
+            return result;
+        }
+        Vector<NodePtr> left;
+        Vector<NodePtr> right;
+        left.Reserve(BRANCHING);
+        right.Reserve(children.Size() - BRANCHING);
+        for (size_t i = 0; i < children.Size(); ++i) {
+            (i < BRANCHING ? left : right).PushBack(std::move(children[i]));
+        }
+        result.PushBack(MakeInternal(std::move(left), shift));
+        result.PushBack(MakeInternal(std::move(right), shift));
+        return result;
+    }
+
+    //           .
+    //  :    BRANCHING 
+    static Vector<NodePtr> JoinSiblings(const NodePtr& left, const NodePtr& right, size_t shift) {
+        if (shift == 0) {
+            Vector<T> values;
+            values.Reserve(BRANCHING);
+            Vector<T> rest;
+            for (const Vector<T>* leaf : { &left->values, &right->values }) {
+                for (const T& value : *leaf) {
+                    (values.Size() < BRANCHING ? values : rest).PushBack(value);
+                }
+            }
+            Vector<NodePtr> result;
+            result.PushBack(MakeLeaf(std::move(values)));
+            if (rest.Size() != 0) {
+                result.PushBack(MakeLeaf(std::move(rest)));
+            }
+            return result;
+        }
+        Vector<NodePtr> children;
+        children.Reserve(left->children.Size() + right->children.Size());
+        for (const NodePtr& child : left->children) {
+            children.PushBack(child);
+        }
+        for (const NodePtr& child : right->children) {
+            children.PushBack(child);
+        }
+        return Split(std::move(children), shift);
+    }
+
+    //  left        right    left
+    static Vector<NodePtr> MergeRight(const NodePtr& left, size_t left_shift, const NodePtr& right, size_t right_shift) {
+        if (left_shift == right_shift) {
+            return JoinSiblings(left, right, left_shift);
+        }
+        const size_t last = left->children.Size() - 1;
+        Vector<NodePtr> tail = MergeRight(left->children[last], left_shift - BITS, right, right_shift);
+        Vector<NodePtr> children;
+        children.Reserve(last + tail.Size());
+        for (size_t i = 0; i < last; ++i) {
+            children.PushBack(left->children[i]);
+        }
+        for (NodePtr& node : tail) {
+            children.PushBack(std::move(node));
+        }
+        return Split(std::move(children), left_shift);
+    }
+
+    //    left  right    right
+    static Vector<NodePtr> MergeLeft(const NodePtr& left, size_t left_shift, const NodePtr& right, size_t right_shift) {
+        if (left_shift == right_shift) {
+            return JoinSiblings(left, right, left_shift);
+        }
+        Vector<NodePtr> head = MergeLeft(left, left_shift, right->children[0], right_shift - BITS);
+        Vector<NodePtr> children;
+        children.Reserve(head.Size() + right->children.Size() - 1);
+        for (NodePtr& node : head) {
+            children.PushBack(std::move(node));
+        }
+        for (size_t i = 1; i < right->children.Size(); ++i) {
+            children.PushBack(right->children[i]);
+        }
+        return Split(std::move(children), right_shift);
+    }
+
+    template <typename Func>
+    static void ForEachInNode(const Node& node, size_t shift, Func& func) {
+        if (shift == 0) {
+            for (const T& value : node.values) {
+                func(value);
+            }
+            return;
+        }
+        for (const NodePtr& child : node.children) {
+            ForEachInNode(*child, shift - BITS, func);
+        }
+    }
+};
+
+//   PersistentVector   .  
+//     ,         Build
+template <typename T>
+class PersistentVector<T>::Builder {
+public:
+    Builder() = default;
+
+    //       base
+    explicit Builder(PersistentVector base)
+        : base_(std::move(base)) {
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    void EmplaceBack(Args&&... args) {
+        if (tail_.Capacity() == 0) {
+            tail_.Reserve(BRANCHING);
+        }
+        tail_.EmplaceBack(std::forward <Args>(args) ...);
+        if (tail_.Size() == BRANCHING) {
+            leaves_.PushBack(MakeLeaf(std::move(tail_)));
+            tail_ = Vector<T>();
+        }
+    }
+
+    PersistentVector Build() && {
+        if (tail_.Size() != 0) {
+            leaves_.PushBack(MakeLeaf(std::move(tail_)));
+        }
+        if (leaves_.Size() == 0) {
+            return std::move(base_);
+        }
+        PersistentVector built;
+        for (const NodePtr& leaf : leaves_) {
+            built.size_ += leaf->values.Size();
+        }
+        Vector<NodePtr> level = std::move(leaves_);
+        while (level.Size() > 1) {
+            built.shift_ += BITS;
+            Vector<NodePtr> parents;
+            parents.Reserve((level.Size() + BRANCHING - 1) / BRANCHING);
+            for (size_t first = 0; first < level.Size(); first += BRANCHING) {
+                Vector<NodePtr> children;
+                children.Reserve(BRANCHING);
+                for (size_t i = first; i < std::min(first + BRANCHING, level.Size()); ++i) {
+                    children.PushBack(std::move(level[i]));
+                }
+                parents.PushBack(MakeInternal(std::move(children), built.shift_));
+            }
+            level = std::move(parents);
+        }
+        built.root_ = std::move(level[0]);
+        return base_.Concat(built);
+    }
+
+private:
+    PersistentVector base_;
+    Vector<NodePtr> leaves_;
+    Vector<T> tail_;
+};
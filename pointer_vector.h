@@ -0,0 +1,326 @@
+#pragma once
+
+#include "vector.h"
+
+#include <iterator>
+
+//  ,    .    
+// (slab) ,   ,    Vector<T*>   .
+//  ,      ,  T   ,
+//   ,        .
+//     , Clear     .
+// ForEach      PREFETCH_DISTANCE  
+template <typename T>
+class PointerVector {
+public:
+    static constexpr size_t MIN_SLAB_CAPACITY = 16;
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+        BasicIterator() = default;
+
+        reference operator*() const noexcept {
+            return **pos_;
+        }
+
+        pointer operator->() const noexcept {
+            return *pos_;
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *pos_[offset];
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++pos_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++pos_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --pos_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --pos_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            pos_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            pos_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.pos_ - rhs.pos_;
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept = default;
+        friend auto operator<=>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept = default;
+
+        operator BasicIterator<true>() const noexcept {
+            return BasicIterator<true>(pos_);
+        }
+
+    private:
+        friend class PointerVector;
+        friend class BasicIterator<!IsConst>;
+
+        explicit BasicIterator(T* const* pos) noexcept
+            : pos_(pos) {
+        }
+
+        T* const* pos_ = nullptr;
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    iterator begin() noexcept {
+        return iterator(pointers_.begin());
+    }
+
+    iterator end() noexcept {
+        return iterator(pointers_.end());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(pointers_.begin());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(pointers_.end());
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    PointerVector() = default;
+
+    //       
+    PointerVector(const PointerVector& other) {
+        Reserve(other.Size());
+        for (const T& value : other) {
+            EmplaceBack(value);
+        }
+    }
+
+    PointerVector(PointerVector&& other) noexcept {
+        Swap(other);
+    }
+
+    PointerVector& operator=(const PointerVector& rhs) {
+        if (this != &rhs) {
+            PointerVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    PointerVector& operator=(PointerVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(PointerVector& other) noexcept {
+        pointers_.Swap(other.pointers_);
+        slabs_.Swap(other.slabs_);
+        free_.Swap(other.free_);
+        std::swap(slab_used_, other.slab_used_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    ~PointerVector() {
+        DestroyAll();
+    }
+
+    size_t Size() const noexcept {
+        return pointers_.Size();
+    }
+
+    //       
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    //    new_capacity :  ,   ,  
+    void Reserve(size_t new_capacity) {
+        pointers_.Reserve(new_capacity);
+        if (new_capacity > capacity_) {
+            AddSlab(new_capacity - capacity_);
+        }
+    }
+
+    //       
+    void Clear() noexcept {
+        DestroyAll();
+        pointers_.Resize(0);
+        free_.Resize(0);
+        slabs_ = {};
+        slab_used_ = 0;
+        capacity_ = 0;
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        return *Emplace(end(), std::forward <Args>(args) ...);
+    }
+
+    void PopBack() noexcept {
+        Erase(end() - 1);
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        const size_t index = pos.pos_ - pointers_.begin();
+        //       
+        if (pointers_.Size() == pointers_.Capacity()) {
+            pointers_.Reserve(pointers_.Size() == 0 ? 1 : pointers_.Size() * 2);
+        }
+        T* slot = AllocateSlot();
+        try {
+            std::construct_at(slot, std::forward <Args>(args) ...);
+        }
+        catch (...) {
+            free_.PushBack(slot);
+            throw;
+        }
+        pointers_.Insert(pointers_.begin() + index, slot);
+        return begin() + index;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    iterator Erase(const_iterator pos) noexcept {
+        const size_t index = pos.pos_ - pointers_.begin();
+        T* slot = pointers_[index];
+        std::destroy_at(slot);
+        //  free_    ,  PushBack   
+        free_.PushBack(slot);
+        pointers_.Erase(pointers_.begin() + index);
+        return begin() + index;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<PointerVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        return *pointers_[index];
+    }
+
+    //  func     ,     
+    template <typename Func>
+    void ForEach(Func func) {
+        const size_t size = pointers_.Size();
+        for (size_t i = 0; i < size; ++i) {
+            if (i + PREFETCH_DISTANCE < size) {
+                Prefetch(pointers_[i + PREFETCH_DISTANCE]);
+            }
+            func(*pointers_[i]);
+        }
+    }
+
+    template <typename Func>
+    void ForEach(Func func) const {
+        const_cast<PointerVector&>(*this).ForEach([&func](const T& value) {
+            func(value);
+            });
+    }
+
+private:
+    static void Prefetch([[maybe_unused]] const T* address) noexcept {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    //   ,       
+    T* AllocateSlot() {
+        if (free_.Size() != 0) {
+            T* slot = free_[free_.Size() - 1];
+            free_.PopBack();
+            return slot;
+        }
+        if (slabs_.Size() == 0 || slab_used_ == slabs_[slabs_.Size() - 1].Capacity()) {
+            AddSlab(std::max(MIN_SLAB_CAPACITY, capacity_));
+        }
+        return slabs_[slabs_.Size() - 1] + slab_used_++;
+    }
+
+    void AddSlab(size_t slab_capacity) {
+        //        
+        const size_t unused = slabs_.Size() == 0 ? 0 : slabs_[slabs_.Size() - 1].Capacity() - slab_used_;
+        free_.Reserve(capacity_ + slab_capacity);
+        slabs_.EmplaceBack(slab_capacity);
+        for (size_t i = 0; i < unused; ++i) {
+            free_.PushBack(slabs_[slabs_.Size() - 2] + slab_used_ + i);
+        }
+        slab_used_ = 0;
+        capacity_ += slab_capacity;
+    }
+
+    void DestroyAll() noexcept {
+        for (T* value : pointers_) {
+            std::destroy_at(value);
+        }
+    }
+
+    Vector<T*> pointers_;
+    Vector<RawMemory<T>> slabs_;
+    //        
+    Vector<T*> free_;
+    size_t slab_used_ = 0;
+    size_t capacity_ = 0;
+};
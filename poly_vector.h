@@ -0,0 +1,244 @@
+#pragma once
+
+#include "vector.h"
+
+#include <atomic>
+#include <typeinfo>
+
+//   ,   Base.    
+//     Vector (),      ,
+//        ,   Vector<std::unique_ptr<Base>>.
+//            Register.
+//     O(1):        ,
+//   type_segments_   .
+//     : ForEach(func)  func(Base&)   ,
+//  ForEach<Derived...>(func)  func(Derived&)   ,  
+//    Derived&    ,  Derived
+//    final.
+//     :   Derived     Derived.
+// Insert      ,  ,  
+//  Base&,   (     Base),    
+//      assert.   Base    Emplace<Base>
+template <typename Base>
+class PolyVector {
+    class SegmentBase;
+
+public:
+    PolyVector() = default;
+
+    PolyVector(const PolyVector& other) {
+        segments_.Reserve(other.segments_.Size());
+        for (const std::unique_ptr<SegmentBase>& segment : other.segments_) {
+            segments_.PushBack(segment->Clone());
+        }
+        type_segments_ = other.type_segments_;
+        size_ = other.size_;
+    }
+
+    PolyVector(PolyVector&& other) noexcept {
+        Swap(other);
+    }
+
+    PolyVector& operator=(const PolyVector& rhs) {
+        if (this != &rhs) {
+            PolyVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    PolyVector& operator=(PolyVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(PolyVector& other) noexcept {
+        segments_.Swap(other.segments_);
+        type_segments_.Swap(other.type_segments_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    //    Derived
+    template <typename Derived>
+    size_t Size() const noexcept {
+        const Vector<Derived>* segment = FindSegment<Derived>();
+        return segment == nullptr ? 0 : segment->Size();
+    }
+
+    //  ,     
+    size_t SegmentCount() const noexcept {
+        return segments_.Size();
+    }
+
+    //    Derived,    ,     
+    template <typename Derived>
+    void Register(size_t capacity = 0) {
+        Segment<Derived>().Reserve(capacity);
+    }
+
+    template <typename Derived, typename... Args>
+    Derived& Emplace(Args&&... args) {
+        Derived& value = Segment<Derived>().EmplaceBack(std::forward <Args>(args) ...);
+        ++size_;
+        return value;
+    }
+
+    template <typename Derived>
+    std::remove_cvref_t<Derived>& Insert(Derived&& value) requires (!std::is_same_v<std::remove_cvref_t<Derived>, Base>) {
+        using Type = std::remove_cvref_t<Derived>;
+        assert(typeid(value) == typeid(Type) && "Insert would slice an object of a more derived type");
+        return Emplace<Type>(std::forward <Derived>(value));
+    }
+
+    //   pos   Derived,     
+    template <typename Derived>
+    typename Vector<Derived>::iterator Erase(typename Vector<Derived>::const_iterator pos) {
+        const auto next = Segment<Derived>().Erase(pos);
+        --size_;
+        return next;
+    }
+
+    //   Derived.       PolyVector
+    template <typename Derived>
+    const Vector<Derived>& Objects() const {
+        static const Vector<Derived> empty;
+        const Vector<Derived>* segment = FindSegment<Derived>();
+        return segment == nullptr ? empty : *segment;
+    }
+
+    //  func(Derived&)      Derived...   
+    template <typename... Derived, typename Func>
+    void ForEach(Func func) requires (sizeof...(Derived) > 0) {
+        (ForEachOf<Derived>(func), ...);
+    }
+
+    template <typename... Derived, typename Func>
+    void ForEach(Func func) const requires (sizeof...(Derived) > 0) {
+        (ForEachOf<Derived>(func), ...);
+    }
+
+    //  func(Base&)   ,       .
+    //            BATCH_SIZE
+    //   Base  ,  func      .
+    //     ,    ;    func
+    //  Base& ,     ForEach<Derived...>
+    template <typename Func>
+    void ForEach(Func func) {
+        const auto visit = [](void* context, Base* const* objects, size_t count) {
+            Func& func = *static_cast<Func*>(context);
+            for (size_t i = 0; i < count; ++i) {
+                func(*objects[i]);
+            }
+        };
+        for (const std::unique_ptr<SegmentBase>& segment : segments_) {
+            segment->ForEachBase(visit, &func);
+        }
+    }
+
+    template <typename Func>
+    void ForEach(Func func) const {
+        const_cast<PolyVector&>(*this).ForEach([&func](const Base& value) {
+            func(value);
+            });
+    }
+
+    //      ForEach    
+    static constexpr size_t BATCH_SIZE = 64;
+
+private:
+    class SegmentBase {
+    public:
+        virtual ~SegmentBase() = default;
+        //  visit(context, objects, count)      BATCH_SIZE
+        virtual void ForEachBase(void (*visit)(void*, Base* const*, size_t), void* context) = 0;
+        virtual std::unique_ptr<SegmentBase> Clone() const = 0;
+    };
+
+    template <typename Derived>
+    class TypedSegment final : public SegmentBase {
+    public:
+        void ForEachBase(void (*visit)(void*, Base* const*, size_t), void* context) override {
+            Base* batch[BATCH_SIZE];
+            for (size_t first = 0; first < values.Size(); first += BATCH_SIZE) {
+                const size_t count = std::min(BATCH_SIZE, values.Size() - first);
+                for (size_t i = 0; i < count; ++i) {
+                    batch[i] = &values[first + i];
+                }
+                visit(context, batch, count);
+            }
+        }
+
+        std::unique_ptr<SegmentBase> Clone() const override {
+            return std::make_unique<TypedSegment>(*this);
+        }
+
+        Vector<Derived> values;
+    };
+
+    //   Derived  ,    PolyVector<Base>
+    template <typename Derived>
+    static size_t TypeIndex() noexcept {
+        static const size_t index = next_type_index_.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    template <typename Derived>
+    Vector<Derived>* FindSegment() noexcept {
+        static_assert(std::is_base_of_v<Base, Derived>, "Derived must be derived from Base");
+        const size_t type = TypeIndex<Derived>();
+        if (type >= type_segments_.Size() || type_segments_[type] == 0) {
+            return nullptr;
+        }
+        return &static_cast<TypedSegment<Derived>&>(*segments_[type_segments_[type] - 1]).values;
+    }
+
+    template <typename Derived>
+    const Vector<Derived>* FindSegment() const noexcept {
+        return const_cast<PolyVector&>(*this).template FindSegment<Derived>();
+    }
+
+    template <typename Derived>
+    Vector<Derived>& Segment() {
+        if (Vector<Derived>* segment = FindSegment<Derived>()) {
+            return *segment;
+        }
+        const size_t type = TypeIndex<Derived>();
+        if (type >= type_segments_.Size()) {
+            type_segments_.Resize(type + 1);
+        }
+        auto segment = std::make_unique<TypedSegment<Derived>>();
+        Vector<Derived>& values = segment->values;
+        segments_.PushBack(std::move(segment));
+        type_segments_[type] = segments_.Size();
+        return values;
+    }
+
+    template <typename Derived, typename Func>
+    void ForEachOf(Func& func) {
+        if (Vector<Derived>* segment = FindSegment<Derived>()) {
+            for (Derived& value : *segment) {
+                func(value);
+            }
+        }
+    }
+
+    template <typename Derived, typename Func>
+    void ForEachOf(Func& func) const {
+        if (const Vector<Derived>* segment = FindSegment<Derived>()) {
+            for (const Derived& value : *segment) {
+                func(value);
+            }
+        }
+    }
+
+    static inline std::atomic<size_t> next_type_index_ = 0;
+
+    Vector<std::unique_ptr<SegmentBase>> segments_;
+    //    -     segments_,   1,  0,   
+    Vector<size_t> type_segments_;
+    size_t size_ = 0;
+};
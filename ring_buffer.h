@@ -0,0 +1,201 @@
+#pragma once
+
+#include "vector.h"
+
+#include <bit>
+#include <span>
+
+//  RingBuffer      
+enum class RingBufferMode {
+    GROW,             //  ,       
+    OVERWRITE_OLDEST, //   ,     
+};
+
+//    FIFO-  RawMemory.    ,
+//     ,   .
+// PushBack  PopFront    O(1)
+template <typename T>
+class RingBuffer {
+public:
+    RingBuffer() = default;
+
+    //      
+    explicit RingBuffer(size_t capacity, RingBufferMode mode = RingBufferMode::GROW)
+        : data_(capacity == 0 ? 0 : std::bit_ceil(capacity))
+        , mode_(mode) {
+        assert(mode == RingBufferMode::GROW || capacity > 0);
+    }
+
+    RingBuffer(const RingBuffer& other)
+        : data_(other.data_.Capacity())
+        , mode_(other.mode_) {
+        const auto [first, second] = other.Spans();
+        std::uninitialized_copy_n(first.data(), first.size(), data_.GetAddress());
+        try {
+            std::uninitialized_copy_n(second.data(), second.size(), data_.GetAddress() + first.size());
+        }
+        catch (...) {
+            std::destroy_n(data_.GetAddress(), first.size());
+            throw;
+        }
+        size_ = other.size_;
+    }
+
+    RingBuffer(RingBuffer&& other) noexcept {
+        Swap(other);
+    }
+
+    RingBuffer& operator=(const RingBuffer& rhs) {
+        if (this != &rhs) {
+            RingBuffer rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    RingBuffer& operator=(RingBuffer&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(RingBuffer& other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        std::swap(mode_, other.mode_);
+    }
+
+    ~RingBuffer() {
+        const auto [first, second] = Spans();
+        std::destroy_n(first.data(), first.size());
+        std::destroy_n(second.data(), second.size());
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    RingBufferMode Mode() const noexcept {
+        return mode_;
+    }
+
+    //        new_capacity.   
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T> new_data(std::bit_ceil(new_capacity));
+        Relocate(new_data, nullptr);
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        T* value_ = nullptr;
+        if (size_ == Capacity()) {
+            if (mode_ == RingBufferMode::OVERWRITE_OLDEST && size_ != 0) {
+                T& oldest = data_[head_];
+                oldest = T(std::forward <Args>(args) ...);
+                head_ = (head_ + 1) & Mask();
+                return oldest;
+            }
+            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+            value_ = new (new_data + size_) T(std::forward <Args>(args) ...);
+            Relocate(new_data, value_);
+        }
+        else {
+            value_ = new (data_ + ((head_ + size_) & Mask())) T(std::forward <Args>(args) ...);
+        }
+        ++size_;
+        return *value_;
+    }
+
+    void PopFront() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(data_.GetAddress() + head_);
+        head_ = (head_ + 1) & Mask();
+        --size_;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(data_.GetAddress() + ((head_ + size_) & Mask()));
+    }
+
+    //     :     .
+    //   ,       
+    std::pair<std::span<T>, std::span<T>> Spans() noexcept {
+        const size_t first_size = std::min(size_, Capacity() - head_);
+        return { { data_.GetAddress() + head_, first_size }, { data_.GetAddress(), size_ - first_size } };
+    }
+
+    std::pair<std::span<const T>, std::span<const T>> Spans() const noexcept {
+        const auto [first, second] = const_cast<RingBuffer&>(*this).Spans();
+        return { first, second };
+    }
+
+    //    index,    
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<RingBuffer&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[(head_ + index) & Mask()];
+    }
+
+private:
+    RawMemory<T> data_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    RingBufferMode mode_ = RingBufferMode::GROW;
+
+    size_t Mask() const noexcept {
+        return Capacity() - 1;
+    }
+
+    //     new_data,  .    ,
+    //    new_data  emplaced 
+    void Relocate(RawMemory<T>& new_data, T* emplaced) {
+        const auto [first, second] = Spans();
+        // constexpr  if     
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(first.data(), first.size(), new_data.GetAddress());
+            std::uninitialized_move_n(second.data(), second.size(), new_data.GetAddress() + first.size());
+        }
+        else {
+            try {
+                std::uninitialized_copy_n(first.data(), first.size(), new_data.GetAddress());
+                try {
+                    std::uninitialized_copy_n(second.data(), second.size(), new_data.GetAddress() + first.size());
+                }
+                catch (...) {
+                    std::destroy_n(new_data.GetAddress(), first.size());
+                    throw;
+                }
+            }
+            catch (...) {
+                if (emplaced != nullptr) {
+                    std::destroy_at(emplaced);
+                }
+                throw;
+            }
+        }
+        std::destroy_n(first.data(), first.size());
+        std::destroy_n(second.data(), second.size());
+        data_.Swap(new_data);
+        head_ = 0;
+    }
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+//      (slot map).     Vector
+//   ,          
+//    . ,      O(1).
+//       ,   
+//  ,         .
+//     :   
+template <typename T>
+class SlotMap {
+public:
+    struct Handle {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        friend bool operator==(const Handle& lhs, const Handle& rhs) noexcept = default;
+    };
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t MAX_SIZE = UINT32_MAX - 1;
+
+    iterator begin() noexcept {
+        return values_.begin();
+    }
+
+    iterator end() noexcept {
+        return values_.end();
+    }
+
+    const_iterator begin() const noexcept {
+        return values_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return values_.end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return values_.Size();
+    }
+
+    void Reserve(size_t new_capacity) {
+        values_.Reserve(new_capacity);
+        dense_to_slot_.Reserve(new_capacity);
+        slots_.Reserve(new_capacity);
+    }
+
+    template <typename... Args>
+    Handle Emplace(Args&&... args) {
+        if (free_head_ == NO_SLOT) {
+            if (slots_.Size() == MAX_SIZE) {
+                throw std::length_error("SlotMap size exceeds 2^32 - 2 elements");
+            }
+            //      ,    
+            slots_.PushBack(Slot{ NO_SLOT, 0 });
+            free_head_ = static_cast<uint32_t>(slots_.Size() - 1);
+        }
+        const uint32_t slot_index = free_head_;
+        values_.EmplaceBack(std::forward <Args>(args) ...);
+        try {
+            dense_to_slot_.PushBack(slot_index);
+        }
+        catch (...) {
+            values_.PopBack();
+            throw;
+        }
+        Slot& slot = slots_[slot_index];
+        free_head_ = slot.index;
+        slot.index = static_cast<uint32_t>(values_.Size() - 1);
+        return { slot_index, slot.generation };
+    }
+
+    Handle Insert(const T& value) {
+        return Emplace(value);
+    }
+
+    Handle Insert(T&& value) {
+        return Emplace(std::move(value));
+    }
+
+    //   handle.  false,   
+    bool Erase(Handle handle) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        if (!Contains(handle)) {
+            return false;
+        }
+        Slot& slot = slots_[handle.index];
+        const size_t last = values_.Size() - 1;
+        if (slot.index != last) {
+            values_[slot.index] = std::move(values_[last]);
+            dense_to_slot_[slot.index] = dense_to_slot_[last];
+            slots_[dense_to_slot_[slot.index]].index = slot.index;
+        }
+        values_.PopBack();
+        dense_to_slot_.PopBack();
+        ++slot.generation;
+        slot.index = free_head_;
+        free_head_ = handle.index;
+        return true;
+    }
+
+    bool Contains(Handle handle) const noexcept {
+        if (handle.index >= slots_.Size()) {
+            return false;
+        }
+        const Slot& slot = slots_[handle.index];
+        //       ,  
+        //      
+        return slot.generation == handle.generation && slot.index < values_.Size()
+            && dense_to_slot_[slot.index] == handle.index;
+    }
+
+    //     nullptr,   
+    T* Find(Handle handle) noexcept {
+        return Contains(handle) ? &values_[slots_[handle.index].index] : nullptr;
+    }
+
+    const T* Find(Handle handle) const noexcept {
+        return const_cast<SlotMap&>(*this).Find(handle);
+    }
+
+    T& operator[](Handle handle) noexcept {
+        assert(Contains(handle));
+        return values_[slots_[handle.index].index];
+    }
+
+    const T& operator[](Handle handle) const noexcept {
+        return const_cast<SlotMap&>(*this)[handle];
+    }
+
+    //  ,    pos  
+    Handle HandleAt(const_iterator pos) const noexcept {
+        const uint32_t slot_index = dense_to_slot_[pos - begin()];
+        return { slot_index, slots_[slot_index].generation };
+    }
+
+private:
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    //    index -    values_,   -   
+    struct Slot {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+    Vector<T> values_;
+    //     ,     
+    Vector<uint32_t> dense_to_slot_;
+    Vector<Slot> slots_;
+    uint32_t free_head_ = NO_SLOT;
+};
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "multi_vector.h"
+
+#include <iterator>
+
+//  ,        (structure of arrays).
+//   ,   Vector.    - -  
+//  ,       std::span   
+template <typename... Ts>
+class SoaVector {
+public:
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+
+    template <bool IsConst>
+    class BasicIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, SoaVector::const_reference, SoaVector::reference>;
+        using pointer = void;
+
+        BasicIterator() = default;
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return (*owner_)[index_ + offset];
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend auto operator<=>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ <=> rhs.index_;
+        }
+
+        //  ,    
+        size_t Index() const noexcept {
+            return index_;
+        }
+
+        operator BasicIterator<true>() const noexcept {
+            return { owner_, index_ };
+        }
+
+    private:
+        friend class SoaVector;
+        friend class BasicIterator<!IsConst>;
+        using Owner = std::conditional_t<IsConst, const SoaVector, SoaVector>;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            : owner_(owner)
+            , index_(index) {
+        }
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    iterator begin() noexcept {
+        return { this, 0 };
+    }
+
+    iterator end() noexcept {
+        return { this, Size() };
+    }
+
+    const_iterator begin() const noexcept {
+        return { this, 0 };
+    }
+
+    const_iterator end() const noexcept {
+        return { this, Size() };
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    SoaVector() = default;
+
+    explicit SoaVector(size_t size)
+        : columns_(size) {
+    }
+
+    void Swap(SoaVector& other) noexcept {
+        columns_.Swap(other.columns_);
+    }
+
+    size_t Size() const noexcept {
+        return columns_.Size();
+    }
+
+    size_t Capacity() const noexcept {
+        return columns_.Capacity();
+    }
+
+    void Reserve(size_t new_capacity) {
+        columns_.Reserve(new_capacity);
+    }
+
+    void Resize(size_t new_size) {
+        columns_.Resize(new_size);
+    }
+
+    //   I- 
+    template <size_t I>
+    auto Column() noexcept {
+        return columns_.template Column<I>();
+    }
+
+    template <size_t I>
+    auto Column() const noexcept {
+        return columns_.template Column<I>();
+    }
+
+    void PushBack(const Ts&... values) {
+        columns_.EmplaceBack(values...);
+    }
+
+    void PushBack(const std::tuple<Ts...>& row) {
+        std::apply([this](const Ts&... values) {
+            columns_.EmplaceBack(values...);
+            }, row);
+    }
+
+    template <typename... Args>
+    reference EmplaceBack(Args&&... values) {
+        columns_.EmplaceBack(std::forward<Args>(values)...);
+        return (*this)[Size() - 1];
+    }
+
+    void PopBack() noexcept {
+        columns_.PopBack();
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... values) {
+        columns_.Emplace(pos.Index(), std::forward<Args>(values)...);
+        return { this, pos.Index() };
+    }
+
+    iterator Insert(const_iterator pos, const Ts&... values) {
+        return Emplace(pos, values...);
+    }
+
+    iterator Insert(const_iterator pos, const std::tuple<Ts...>& row) {
+        return std::apply([this, pos](const Ts&... values) {
+            return Emplace(pos, values...);
+            }, row);
+    }
+
+    iterator Erase(const_iterator pos) noexcept((std::is_nothrow_move_assignable_v<Ts> && ...)) {
+        columns_.Erase(pos.Index());
+        return { this, pos.Index() };
+    }
+
+    const_reference operator[](size_t index) const noexcept {
+        return Row(index, std::index_sequence_for<Ts...>{});
+    }
+
+    reference operator[](size_t index) noexcept {
+        return Row(index, std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    MultiVector<Ts...> columns_;
+
+    template <size_t... Is>
+    reference Row(size_t index, std::index_sequence<Is...>) noexcept {
+        return { columns_.template Get<Is>(index)... };
+    }
+
+    template <size_t... Is>
+    const_reference Row(size_t index, std::index_sequence<Is...>) const noexcept {
+        return { columns_.template Get<Is>(index)... };
+    }
+};
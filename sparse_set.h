@@ -0,0 +1,210 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <tuple>
+
+//   (sparse set)     -.
+//        Vector      .
+//         .    
+//  PAGE_SIZE ,        , 
+//          .    
+//        sizeof(Vector<Key>) (24 )  
+//  :   2^32     24 .
+// ,      O(1).      
+// ,     
+template <typename T>
+class SparseSet {
+public:
+    using Key = uint32_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    iterator begin() noexcept {
+        return values_.begin();
+    }
+
+    iterator end() noexcept {
+        return values_.end();
+    }
+
+    const_iterator begin() const noexcept {
+        return values_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return values_.end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return values_.Size();
+    }
+
+    void Reserve(size_t new_capacity) {
+        values_.Reserve(new_capacity);
+        keys_.Reserve(new_capacity);
+    }
+
+    //    : keys[i] -   *(begin() + i)
+    const Vector<Key>& Keys() const noexcept {
+        return keys_;
+    }
+
+    //    key.    ,   
+    template <typename... Args>
+    T& Emplace(Key key, Args&&... args) {
+        if (T* value = Find(key)) {
+            return *value;
+        }
+        //     ,    
+        Key& index = SparseEntry(key);
+        T& value = values_.EmplaceBack(std::forward <Args>(args) ...);
+        try {
+            keys_.PushBack(key);
+        }
+        catch (...) {
+            values_.PopBack();
+            throw;
+        }
+        index = static_cast<Key>(values_.Size() - 1);
+        return value;
+    }
+
+    T& Insert(Key key, const T& value) {
+        return Emplace(key, value);
+    }
+
+    T& Insert(Key key, T&& value) {
+        return Emplace(key, std::move(value));
+    }
+
+    //     key.  false,   
+    bool Erase(Key key) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        const Key index = IndexOf(key);
+        if (index == NO_INDEX) {
+            return false;
+        }
+        const size_t last = values_.Size() - 1;
+        if (index != last) {
+            values_[index] = std::move(values_[last]);
+            keys_[index] = keys_[last];
+            pages_[keys_[index] / PAGE_SIZE][keys_[index] % PAGE_SIZE] = index;
+        }
+        values_.PopBack();
+        keys_.PopBack();
+        pages_[key / PAGE_SIZE][key % PAGE_SIZE] = NO_INDEX;
+        return true;
+    }
+
+    //   ,       
+    void Clear() noexcept {
+        for (const Key key : keys_) {
+            pages_[key / PAGE_SIZE][key % PAGE_SIZE] = NO_INDEX;
+        }
+        values_.Resize(0);
+        keys_.Resize(0);
+    }
+
+    bool Contains(Key key) const noexcept {
+        return IndexOf(key) != NO_INDEX;
+    }
+
+    //     nullptr,   
+    T* Find(Key key) noexcept {
+        const Key index = IndexOf(key);
+        return index == NO_INDEX ? nullptr : &values_[index];
+    }
+
+    const T* Find(Key key) const noexcept {
+        return const_cast<SparseSet&>(*this).Find(key);
+    }
+
+    T& operator[](Key key) noexcept {
+        assert(Contains(key));
+        return values_[IndexOf(key)];
+    }
+
+    const T& operator[](Key key) const noexcept {
+        return const_cast<SparseSet&>(*this)[key];
+    }
+
+private:
+    static constexpr Key NO_INDEX = UINT32_MAX;
+
+    Key IndexOf(Key key) const noexcept {
+        const size_t page = key / PAGE_SIZE;
+        if (page >= pages_.Size() || pages_[page].Size() == 0) {
+            return NO_INDEX;
+        }
+        return pages_[page][key % PAGE_SIZE];
+    }
+
+    //     key,     
+    Key& SparseEntry(Key key) {
+        const size_t page = key / PAGE_SIZE;
+        if (page >= pages_.Size()) {
+            pages_.Resize(page + 1);
+        }
+        if (pages_[page].Size() == 0) {
+            Vector<Key> new_page(PAGE_SIZE);
+            std::fill(new_page.begin(), new_page.end(), NO_INDEX);
+            pages_[page] = std::move(new_page);
+        }
+        return pages_[page][key % PAGE_SIZE];
+    }
+
+    Vector<T> values_;
+    Vector<Key> keys_;
+    //  Vector -    
+    Vector<Vector<Key>> pages_;
+};
+
+//  func(key, value...)   ,      sets.
+//           ,  
+//       ,    
+//  .    :    .
+//       ForEachIntersectionOrdered.
+//      ,   .
+// func       
+template <typename Func, typename... Sets>
+void ForEachIntersection(Func func, Sets&... sets) {
+    static_assert(sizeof...(Sets) > 0, "At least one set is required");
+    const Vector<uint32_t>* smallest = nullptr;
+    ((smallest = smallest == nullptr || sets.Size() < smallest->Size() ? &sets.Keys() : smallest), ...);
+    for (const uint32_t key : *smallest) {
+        const std::tuple values{ sets.Find(key)... };
+        const bool found = std::apply([](const auto*... value) {
+            return ((value != nullptr) && ...);
+            }, values);
+        if (found) {
+            std::apply([&func, key](auto*... value) {
+                func(key, *value...);
+                }, values);
+        }
+    }
+}
+
+//  ForEachIntersection,     .    
+//  ,     O(k log k)  Vector  k  
+template <typename Func, typename... Sets>
+void ForEachIntersectionOrdered(Func func, Sets&... sets) {
+    Vector<uint32_t> keys;
+    ForEachIntersection([&keys](uint32_t key, const auto&...) {
+        keys.PushBack(key);
+        }, std::as_const(sets)...);
+    std::sort(keys.begin(), keys.end());
+    for (const uint32_t key : keys) {
+        func(key, sets[key]...);
+    }
+}
@@ -0,0 +1,323 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+
+//  ,        RawMemory<char>.
+//         ,   std::string_view.
+//        std::string   ,
+//        .
+// Sort   ,    .    
+//    ,    . Compact  
+//     .
+// string_view     StringVector
+class StringVector {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::string_view;
+        using pointer = void;
+
+        const_iterator() = default;
+
+        std::string_view operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        std::string_view operator[](difference_type offset) const noexcept {
+            return (*owner_)[index_ + offset];
+        }
+
+        const_iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        const_iterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator old = *this;
+            --index_;
+            return old;
+        }
+
+        const_iterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        const_iterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend const_iterator operator+(difference_type offset, const_iterator it) noexcept {
+            return it += offset;
+        }
+
+        friend const_iterator operator-(const_iterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.index_ <=> rhs.index_;
+        }
+
+    private:
+        friend class StringVector;
+
+        const_iterator(const StringVector* owner, size_t index) noexcept
+            : owner_(owner)
+            , index_(index) {
+        }
+
+        const StringVector* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using iterator = const_iterator;
+
+    StringVector() = default;
+
+    //     
+    StringVector(const StringVector& other)
+        : chars_(other.CharCount())
+        , entries_(other.entries_) {
+        for (Entry& entry : entries_) {
+            const uint32_t offset = static_cast<uint32_t>(char_size_);
+            AppendChars(other.View(entry));
+            entry.offset = offset;
+        }
+    }
+
+    StringVector(StringVector&& other) noexcept {
+        Swap(other);
+    }
+
+    StringVector& operator=(const StringVector& rhs) {
+        if (this != &rhs) {
+            StringVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    StringVector& operator=(StringVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(StringVector& other) noexcept {
+        chars_.Swap(other.chars_);
+        entries_.Swap(other.entries_);
+        std::swap(char_size_, other.char_size_);
+        std::swap(garbage_, other.garbage_);
+    }
+
+    const_iterator begin() const noexcept {
+        return { this, 0 };
+    }
+
+    const_iterator end() const noexcept {
+        return { this, entries_.Size() };
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return entries_.Size();
+    }
+
+    //     
+    size_t CharCount() const noexcept {
+        return char_size_ - garbage_;
+    }
+
+    //  ,         Compact
+    size_t Garbage() const noexcept {
+        return garbage_;
+    }
+
+    void Reserve(size_t string_capacity, size_t char_capacity) {
+        entries_.Reserve(string_capacity);
+        if (char_capacity > chars_.Capacity()) {
+            GrowChars(char_capacity - char_size_);
+        }
+    }
+
+    std::string_view operator[](size_t index) const noexcept {
+        assert(index < entries_.Size());
+        return View(entries_[index]);
+    }
+
+    // value      StringVector
+    void PushBack(std::string_view value) {
+        const RawMemory<char> old_chars = GrowChars(value.size());
+        GrowEntries(1);
+        entries_.PushBack({ AppendChars(value), static_cast<uint32_t>(value.size()) });
+    }
+
+    //     strings,      .
+    //       StringVector
+    template <typename Strings>
+    void Append(const Strings& strings) {
+        size_t count = 0;
+        size_t char_count = 0;
+        for (const auto& value : strings) {
+            ++count;
+            char_count += std::string_view(value).size();
+        }
+        const RawMemory<char> old_chars = GrowChars(char_count);
+        GrowEntries(count);
+        for (const auto& value : strings) {
+            const std::string_view view(value);
+            entries_.PushBack({ AppendChars(view), static_cast<uint32_t>(view.size()) });
+        }
+    }
+
+    void PopBack() noexcept {
+        assert(entries_.Size() != 0);
+        const Entry entry = entries_[entries_.Size() - 1];
+        entries_.PopBack();
+        if (entry.offset + entry.size == char_size_) {
+            char_size_ = entry.offset;
+        }
+        else {
+            garbage_ += entry.size;
+        }
+    }
+
+    //   index. ,   ,    
+    void Set(size_t index, std::string_view value) {
+        assert(index < entries_.Size());
+        Entry& entry = entries_[index];
+        if (value.size() <= entry.size) {
+            if (!value.empty()) {
+                std::memmove(chars_ + entry.offset, value.data(), value.size());
+            }
+            garbage_ += entry.size - value.size();
+            entry.size = static_cast<uint32_t>(value.size());
+            return;
+        }
+        const RawMemory<char> old_chars = GrowChars(value.size());
+        const uint32_t offset = AppendChars(value);
+        garbage_ += entry.size;
+        entry = { offset, static_cast<uint32_t>(value.size()) };
+    }
+
+    //  ,   
+    template <typename Compare = std::less<>>
+    void Sort(Compare compare = {}) {
+        std::sort(entries_.begin(), entries_.end(), [this, &compare](const Entry& lhs, const Entry& rhs) {
+            return compare(View(lhs), View(rhs));
+            });
+    }
+
+    //     ,  
+    void Compact() {
+        RawMemory<char> new_chars(CharCount());
+        uint32_t offset = 0;
+        for (Entry& entry : entries_) {
+            if (entry.size != 0) {
+                std::memcpy(new_chars + offset, chars_ + entry.offset, entry.size);
+            }
+            entry.offset = offset;
+            offset += entry.size;
+        }
+        chars_.Swap(new_chars);
+        char_size_ = offset;
+        garbage_ = 0;
+    }
+
+private:
+    struct Entry {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    std::string_view View(Entry entry) const noexcept {
+        return { chars_ + entry.offset, entry.size };
+    }
+
+    static void CheckOffset(size_t size) {
+        if (size > UINT32_MAX) {
+            throw std::length_error("StringVector exceeds 2^32 - 1 characters");
+        }
+    }
+
+    //    extra ,      .
+    //     :      ,
+    //    ,    
+    RawMemory<char> GrowChars(size_t extra) {
+        const size_t new_size = char_size_ + extra;
+        CheckOffset(new_size);
+        RawMemory<char> old_chars;
+        if (new_size > chars_.Capacity()) {
+            RawMemory<char> new_chars(std::max(char_size_ * 2, new_size));
+            if (char_size_ != 0) {
+                std::memcpy(new_chars.GetAddress(), chars_.GetAddress(), char_size_);
+            }
+            chars_.Swap(new_chars);
+            old_chars.Swap(new_chars);
+        }
+        return old_chars;
+    }
+
+    void GrowEntries(size_t extra) {
+        if (entries_.Size() + extra > entries_.Capacity()) {
+            entries_.Reserve(std::max(entries_.Size() * 2, entries_.Size() + extra));
+        }
+    }
+
+    //     ,     
+    uint32_t AppendChars(std::string_view value) noexcept {
+        const uint32_t offset = static_cast<uint32_t>(char_size_);
+        if (!value.empty()) {
+            std::memcpy(chars_ + char_size_, value.data(), value.size());
+        }
+        char_size_ += value.size();
+        return offset;
+    }
+
+    //  ,     char_size_
+    RawMemory<char> chars_;
+    size_t char_size_ = 0;
+    Vector<Entry> entries_;
+    size_t garbage_ = 0;
+};
@@ -1,10 +1,43 @@
 #include "vector.h"
+#include "compact_vector.h"
+#include "thin_vector.h"
+#include "multi_vector.h"
+#include "soa_vector.h"
+#include "devector.h"
+#include "ring_buffer.h"
+#include "gap_vector.h"
+#include "tiered_vector.h"
+#include "persistent_vector.h"
+#include "cow_vector.h"
+#include "colony.h"
+#include "slot_map.h"
+#include "sparse_set.h"
+#include "index_list.h"
+#include "inplace_vector.h"
+#include "poly_vector.h"
+#include "pointer_vector.h"
+#include "jagged_vector.h"
+#include "string_vector.h"
+#include "intern_pool.h"
+#include "flat_map.h"
 
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <list>
+#include <map>
+#include <numeric>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace {
 
     // "" ,     
@@ -563,89 +596,2351 @@ void Test6() {
     }
 }
 
-struct C {
-    C() noexcept {
-        ++def_ctor;
+void Test7() {
+    const size_t SIZE = 1'000'000;
+    const int MAGIC = 42;
+    {
+        using HugeVector = Vector<int, PagePolicy<true, 1024 * 1024>>;
+        HugeVector v;
+        v.Reserve(SIZE);
+        assert(v.Capacity() == SIZE);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % RawMemory<int>::HUGE_PAGE_SIZE == 0);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        v[SIZE - 1] = MAGIC;
+        assert(v.Size() == SIZE);
+        assert(v[SIZE / 2] == static_cast<int>(SIZE / 2));
+        assert(v[SIZE - 1] == MAGIC);
+
+        HugeVector v_copy(v);
+        assert(v_copy[SIZE - 1] == MAGIC);
     }
-    C(const C& /*other*/) noexcept {
-        ++copy_ctor;
+    {
+        Obj::ResetCounters();
+        {
+            Vector<Obj, PagePolicy<true>> v(SIZE / 10);
+            v.EmplaceBack(MAGIC);
+            assert(v[SIZE / 10].id == MAGIC);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
     }
-    C(C&& /*other*/) noexcept {
-        ++move_ctor;
+}
+
+#if defined(__linux__)
+// ,     [begin, end)    
+size_t CountResidentPages(const void* begin, const void* end) {
+    const size_t page = RawMemory<char>::BASE_PAGE_SIZE;
+    const uintptr_t first = reinterpret_cast<uintptr_t>(begin) / page * page;
+    const uintptr_t last = reinterpret_cast<uintptr_t>(end);
+    std::vector<unsigned char> residency((last - first + page - 1) / page);
+    mincore(reinterpret_cast<void*>(first), last - first, residency.data());
+    return std::count_if(residency.begin(), residency.end(), [](unsigned char flags) {
+        return (flags & 1) != 0;
+        });
+}
+#endif
+
+void Test8() {
+    const size_t SIZE = 1'000'000;
+    const size_t NEW_SIZE = 1'000;
+    const int MAGIC = 42;
+    {
+        Vector<int, PagePolicy<true, 1024 * 1024>> v(SIZE);
+        v[NEW_SIZE - 1] = MAGIC;
+        const int* old_data = v.begin();
+        v.Resize(NEW_SIZE);
+        v.ReleaseUnusedPages();
+        assert(v.Capacity() == SIZE);
+        assert(v.begin() == old_data);
+        assert(v[NEW_SIZE - 1] == MAGIC);
+#if defined(__linux__)
+        const int* tail = v.begin() + NEW_SIZE + RawMemory<int>::BASE_PAGE_SIZE / sizeof(int);
+        assert(CountResidentPages(tail, v.begin() + SIZE) == 0);
+#endif
+        v.Resize(SIZE);
+        assert(v[SIZE - 1] == 0);
     }
-    C& operator=(const C& other) noexcept {
-        if (this != &other) {
-            ++copy_assign;
+    {
+        Vector<int, PagePolicy<true, 1024 * 1024, true>> v(SIZE);
+        v[NEW_SIZE - 1] = MAGIC;
+        v.Resize(SIZE / 2);
+        while (v.Size() > NEW_SIZE) {
+            v.PopBack();
         }
-        return *this;
+        assert(v[NEW_SIZE - 1] == MAGIC);
+#if defined(__linux__)
+        const int* tail = v.begin() + NEW_SIZE + RawMemory<int>::BASE_PAGE_SIZE / sizeof(int);
+        assert(CountResidentPages(tail, v.begin() + SIZE) == 0);
+#endif
     }
-    C& operator=(C&& /*other*/) noexcept {
-        ++move_assign;
-        return *this;
+    {
+        //      ,     
+        struct Record {
+            char bytes[24] = {};
+        };
+        const size_t RECORDS = 100'000;
+        Vector<Record, PagePolicy<true, 1024 * 1024, true>> v(RECORDS);
+        v[NEW_SIZE - 1].bytes[23] = MAGIC;
+        v.Resize(RECORDS / 2);
+        while (v.Size() > NEW_SIZE) {
+            v.PopBack();
+        }
+        assert(v[NEW_SIZE - 1].bytes[23] == MAGIC);
+#if defined(__linux__)
+        const Record* tail = v.begin() + NEW_SIZE + RawMemory<Record>::BASE_PAGE_SIZE / sizeof(Record) + 1;
+        assert(CountResidentPages(tail, v.begin() + RECORDS) == 0);
+#endif
+        while (v.Size() > 0) {
+            v.PopBack();
+        }
+#if defined(__linux__)
+        assert(CountResidentPages(v.begin() + RawMemory<Record>::BASE_PAGE_SIZE / sizeof(Record) + 1, v.begin() + RECORDS) == 0);
+#endif
     }
-    ~C() {
-        ++dtor;
+}
+
+struct alignas(64) CacheLine {
+    int value = 0;
+};
+
+struct alignas(128) OverAligned {
+    int value = 0;
+};
+
+//  ,        
+struct ThrowingMoveOnly {
+    explicit ThrowingMoveOnly(int value)
+        : value(value) {
     }
 
-    static void Reset() {
-        def_ctor = 0;
-        copy_ctor = 0;
-        move_ctor = 0;
-        copy_assign = 0;
-        move_assign = 0;
-        dtor = 0;
+    ThrowingMoveOnly(const ThrowingMoveOnly&) = delete;
+
+    ThrowingMoveOnly(ThrowingMoveOnly&& other)
+        : value(other.value) {
+        if (move_throw_countdown > 0 && --move_throw_countdown == 0) {
+            throw std::runtime_error("Oops");
+        }
     }
 
-    inline static size_t def_ctor = 0;
-    inline static size_t copy_ctor = 0;
-    inline static size_t move_ctor = 0;
-    inline static size_t copy_assign = 0;
-    inline static size_t move_assign = 0;
-    inline static size_t dtor = 0;
+    ThrowingMoveOnly& operator=(ThrowingMoveOnly&&) = default;
+
+    int value = 0;
+
+    static inline int move_throw_countdown = 0;
 };
 
-void Dump() {
-    using namespace std;
-    cerr << "Def ctors: "sv << C::def_ctor              //
-        << ", Copy ctors: "sv << C::copy_ctor          //
-        << ", Move ctors: "sv << C::move_ctor          //
-        << ", Copy assignments: "sv << C::copy_assign  //
-        << ", Move assignments: "sv << C::move_assign  //
-        << ", Dtors: "sv << C::dtor << endl;
+void Test9() {
+    const size_t SIZE = 1000;
+    {
+        Vector<CacheLine> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(CacheLine{ static_cast<int>(i) });
+            assert(reinterpret_cast<uintptr_t>(v.begin()) % alignof(CacheLine) == 0);
+        }
+        assert(v[SIZE - 1].value == static_cast<int>(SIZE - 1));
+    }
+    {
+        AlignedVector<float, 64> v(SIZE);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 64 == 0);
+        v.Reserve(SIZE * 3);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 64 == 0);
+        static_assert(RawMemory<char, PagePolicy<>, 32>::ALIGNMENT == 32);
+        static_assert(RawMemory<CacheLine, PagePolicy<>, 16>::ALIGNMENT == 64);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            Vector<Obj, PagePolicy<>, 128> v(SIZE);
+            v.Insert(v.begin() + 1, Obj{ 1 });
+            assert(reinterpret_cast<uintptr_t>(v.begin()) % 128 == 0);
+            assert(v[1].id == 1);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
 }
 
-void Benchmark() {
-    using namespace std;
-    try {
-        const size_t NUM = 10;
-        C c;
+void Test10() {
+    using namespace std::literals;
+    const size_t SIZE = 100;
+    static_assert(sizeof(void*) != 8 || sizeof(CompactVector<int>) == 16);
+    {
+        Obj::ResetCounters();
         {
-            cerr << "std::vector:"sv << endl;
-            C::Reset();
-            vector<C> v(NUM);
-            Dump();
-            v.push_back(c);
+            CompactVector<Obj> v(SIZE);
+            v[SIZE - 1].id = 7;
+            v.EmplaceBack(1, "Ivan"s);
+            assert(v.Size() == SIZE + 1);
+            assert(v.Capacity() == SIZE * 2);
+            assert(v[SIZE - 1].id == 7);
+            assert(v[SIZE].name == "Ivan"s);
+
+            CompactVector<Obj> v_copy(v);
+            v_copy.Erase(v_copy.begin());
+            assert(v_copy.Size() == SIZE);
+            assert(v_copy[SIZE - 2].id == 7);
+            v = v_copy;
+            assert(v.Size() == SIZE);
         }
-        Dump();
+        assert(Obj::GetAliveObjectCount() == 0);
     }
-    catch (...) {
+    {
+        CompactVector<std::string> v;
+        v.Reserve(4);
+        v.PushBack("a"s);
+        v.PushBack("b"s);
+        v.Insert(v.begin(), "x"s);
+        v.Insert(v.begin() + 1, v[2]);
+        v.Insert(v.end(), "z"s);
+        v.Insert(v.begin(), "y"s);
+        assert(v.Size() == 6);
+        const std::vector<std::string> expected = { "y"s, "x"s, "b"s, "a"s, "b"s, "z"s };
+        assert(std::equal(v.begin(), v.end(), expected.begin()));
+        v.Resize(1);
+        assert(v[0] == "y"s);
     }
-    try {
-        const size_t NUM = 10;
-        C c;
+    {
+        CompactVector<char> v;
+        try {
+            v.Reserve(CompactVector<char>::MAX_SIZE + size_t{ 1 });
+            assert(false && "Exception is expected");
+        }
+        catch (const std::length_error&) {
+        }
+        assert(v.Capacity() == 0);
+    }
+}
+
+void Test11() {
+    using namespace std::literals;
+    const size_t SIZE = 100;
+    static_assert(sizeof(ThinVector<int>) == sizeof(void*));
+    {
+        ThinVector<int> v;
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(v.begin() == nullptr);
+        ThinVector<int> v_copy(v);
+        assert(v_copy.begin() == nullptr);
+    }
+    {
+        Obj::ResetCounters();
         {
-            cerr << "Vector:"sv << endl;
-            C::Reset();
-            Vector<C> v(NUM);
-            Dump();
-            v.PushBack(c);
+            ThinVector<Obj> v(SIZE);
+            v[SIZE - 1].id = 7;
+            v.EmplaceBack(1, "Ivan"s);
+            assert(v.Size() == SIZE + 1);
+            assert(v.Capacity() == SIZE * 2);
+            assert(v[SIZE - 1].id == 7);
+            assert(v[SIZE].name == "Ivan"s);
+
+            ThinVector<Obj> v_copy(v);
+            v_copy.Erase(v_copy.begin());
+            assert(v_copy.Size() == SIZE);
+            assert(v_copy[SIZE - 2].id == 7);
+            v = v_copy;
+            assert(v.Size() == SIZE);
+            v.Resize(0);
+            assert(v.Capacity() == SIZE * 2);
         }
-        Dump();
+        assert(Obj::GetAliveObjectCount() == 0);
     }
-    catch (...) {
+    {
+        ThinVector<std::string> v;
+        v.Insert(v.begin(), "a"s);
+        v.Insert(v.begin(), "x"s);
+        v.Insert(v.begin() + 1, v[0]);
+        v.Reserve(10);
+        v.Insert(v.begin() + 1, "y"s);
+        v.PushBack(v[0]);
+        const std::vector<std::string> expected = { "x"s, "y"s, "x"s, "a"s, "x"s };
+        assert(v.Size() == expected.size());
+        assert(std::equal(v.begin(), v.end(), expected.begin()));
+    }
+    {
+        ThinVector<CacheLine> v;
+        v.PushBack(CacheLine{ 1 });
+        v.PushBack(CacheLine{ 2 });
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % alignof(CacheLine) == 0);
+        assert(v[1].value == 2);
+    }
+}
+
+void Test12() {
+    using namespace std::literals;
+    const size_t SIZE = 1000;
+    {
+        MultiVector<uint32_t, double, char> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(static_cast<uint32_t>(i), i * 0.5, static_cast<char>('a' + i % 26));
+        }
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == 1024);
+        assert(v.Get<0>(SIZE - 1) == SIZE - 1);
+        assert(v.Get<1>(10) == 5.0);
+        assert(v.Get<2>(27) == 'b');
+
+        const auto ids = v.Column<0>();
+        const auto values = v.Column<1>();
+        assert(ids.size() == SIZE);
+        assert(reinterpret_cast<uintptr_t>(ids.data()) % MultiVector<uint32_t>::CACHE_LINE_SIZE == 0);
+        assert(reinterpret_cast<uintptr_t>(values.data()) % MultiVector<uint32_t>::CACHE_LINE_SIZE == 0);
+        assert(std::accumulate(ids.begin(), ids.end(), size_t{ 0 }) == SIZE * (SIZE - 1) / 2);
+
+        const auto v_copy(v);
+        v.Resize(10);
+        v.PopBack();
+        assert(v.Size() == 9);
+        assert(v_copy.Size() == SIZE);
+        assert(v_copy.Column<2>()[SIZE - 1] == v_copy.Get<2>(SIZE - 1));
+    }
+    {
+        Obj::ResetCounters();
+        {
+            MultiVector<Obj, std::string> v(SIZE);
+            v.EmplaceBack(1, "Ivan"s);
+            v.EmplaceBack(Obj(2), "Petr"s);
+            assert(v.Size() == SIZE + 2);
+            assert(v.Get<0>(SIZE + 1).id == 2);
+            assert(v.Get<1>(SIZE) == "Ivan"s);
+            assert(Obj::GetAliveObjectCount() == SIZE + 2);
+
+            Obj::default_construction_throw_countdown = 5;
+            try {
+                v.Resize(SIZE * 2);
+                assert(false && "Exception is expected");
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(v.Size() == SIZE + 2);
+            assert(Obj::GetAliveObjectCount() == SIZE + 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //     -
+        MultiVector<char, OverAligned> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack('x', OverAligned{ i });
+            assert(reinterpret_cast<uintptr_t>(&v.Column<1>()[0]) % alignof(OverAligned) == 0);
+        }
+        assert(v.Get<1>(99).value == 99);
+    }
+    {
+        //      :     
+        Obj::ResetCounters();
+        {
+            MultiVector<Obj, ThrowingMoveOnly> v;
+            v.Reserve(10);
+            for (int i = 0; i < 10; ++i) {
+                v.EmplaceBack(i, ThrowingMoveOnly(i));
+            }
+            ThrowingMoveOnly::move_throw_countdown = 5;
+            try {
+                v.Reserve(100);
+                assert(false && "Exception is expected");
+            }
+            catch (const std::runtime_error&) {
+            }
+            ThrowingMoveOnly::move_throw_countdown = 0;
+            assert(v.Size() == 10 && Obj::GetAliveObjectCount() == 10);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test13() {
+    using namespace std::literals;
+    {
+        SoaVector<int, std::string, double> v;
+        v.PushBack(1, "one"s, 1.5);
+        v.EmplaceBack(3, "three"s, 3.5);
+        v.Insert(v.begin() + 1, 2, "two"s, 2.5);
+        v.Insert(v.begin(), v[2]);
+        assert(v.Size() == 4);
+        assert(std::get<0>(v[0]) == 3);
+        assert(std::get<1>(v[2]) == "two"s);
+
+        auto [id, name, weight] = v[1];
+        id = 10;
+        name = "ten"s;
+        assert(std::get<0>(v[1]) == 10);
+        assert(v.Column<1>()[1] == "ten"s);
+        assert(weight == 1.5);
+
+        auto it = v.Erase(v.begin());
+        assert(it == v.begin());
+        assert(v.Size() == 3);
+        const std::vector<int> expected_ids = { 10, 2, 3 };
+        const auto ids = v.Column<0>();
+        assert(std::equal(ids.begin(), ids.end(), expected_ids.begin(), expected_ids.end()));
+
+        double total = 0;
+        for (auto row : v) {
+            total += std::get<2>(row);
+        }
+        assert(total == 1.5 + 2.5 + 3.5);
+        assert(std::find_if(v.cbegin(), v.cend(), [](const auto& row) {
+            return std::get<1>(row) == "three"s;
+            }) - v.cbegin() == 2);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            SoaVector<Obj, int> v(10);
+            v.Reserve(20);
+            v.Emplace(v.begin() + 3, Obj(5), 5);
+            assert(std::get<0>(v[3]).id == 5);
+            v.Erase(v.begin() + 3);
+            assert(v.Size() == 10);
+            assert(Obj::GetAliveObjectCount() == 10);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test14() {
+    using namespace std::literals;
+    const size_t SIZE = 1000;
+    {
+        Devector<int> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushFront(static_cast<int>(i));
+            v.PushBack(static_cast<int>(i));
+        }
+        assert(v.Size() == SIZE * 2);
+        assert(v[0] == static_cast<int>(SIZE - 1));
+        assert(v[SIZE * 2 - 1] == static_cast<int>(SIZE - 1));
+        assert(v[SIZE - 1] == 0 && v[SIZE] == 0);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PopFront();
+        }
+        assert(v[0] == 0);
+        assert(v.end() - v.begin() == static_cast<std::ptrdiff_t>(SIZE));
+    }
+    {
+        //       
+        Devector<int> queue;
+        for (size_t i = 0; i < SIZE * 100; ++i) {
+            queue.PushBack(static_cast<int>(i));
+            if (queue.Size() > 10) {
+                queue.PopFront();
+            }
+        }
+        assert(queue.Size() == 10);
+        assert(queue[0] == static_cast<int>(SIZE * 100 - 10));
+        assert(queue.Capacity() <= 40);
+    }
+    {
+        //       std::vector
+        Devector<std::string> v;
+        std::vector<std::string> expected;
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < SIZE * 5; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const size_t pos = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+            if (seed % 3 == 0 && pos < expected.size()) {
+                v.Erase(v.begin() + pos);
+                expected.erase(expected.begin() + pos);
+            }
+            else if (seed % 7 == 0 && !expected.empty()) {
+                v.Insert(v.begin() + pos, v[expected.size() / 2]);
+                expected.insert(expected.begin() + pos, std::string(expected[expected.size() / 2]));
+            }
+            else {
+                v.Insert(v.begin() + pos, std::to_string(i));
+                expected.insert(expected.begin() + pos, std::to_string(i));
+            }
+        }
+        assert(v.Size() == expected.size());
+        assert(std::equal(v.begin(), v.end(), expected.begin()));
+    }
+    {
+        Obj::ResetCounters();
+        {
+            Devector<Obj> v(SIZE);
+            v.EmplaceFront(1, "Ivan"s);
+            assert(v.FrontCapacity() + v.Size() + v.BackCapacity() == v.Capacity());
+            const Devector<Obj> v_copy(v);
+            assert(v_copy[0].id == 1);
+            v.Resize(1);
+            assert(v[0].name == "Ivan"s);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test15() {
+    using namespace std::literals;
+    const size_t SIZE = 1000;
+    {
+        RingBuffer<int> ring;
+        for (size_t i = 0; i < SIZE; ++i) {
+            ring.PushBack(static_cast<int>(i));
+            if (i % 3 == 0) {
+                ring.PopFront();
+            }
+        }
+        assert(ring.Size() == SIZE - (SIZE + 2) / 3);
+        assert((ring.Capacity() & (ring.Capacity() - 1)) == 0);
+        assert(ring[0] == static_cast<int>(SIZE - ring.Size()));
+        assert(ring[ring.Size() - 1] == static_cast<int>(SIZE - 1));
+
+        const auto [first, second] = ring.Spans();
+        assert(first.size() + second.size() == ring.Size());
+        std::vector<int> contents(first.begin(), first.end());
+        contents.insert(contents.end(), second.begin(), second.end());
+        for (size_t i = 0; i < contents.size(); ++i) {
+            assert(contents[i] == ring[i]);
+        }
+    }
+    {
+        RingBuffer<std::string> ring(4);
+        ring.PushBack("a"s);
+        ring.PushBack("b"s);
+        ring.PushBack("c"s);
+        ring.PopFront();
+        ring.PopFront();
+        ring.PushBack("d"s);
+        ring.PushBack("e"s);
+        ring.PushBack("f"s);
+        assert(ring.Size() == 4);
+        assert(ring.Spans().second.size() == 2);
+        //        
+        ring.PushBack(ring[0]);
+        assert(ring.Capacity() == 8);
+        assert(ring.Spans().second.empty());
+        const std::vector<std::string> expected = { "c"s, "d"s, "e"s, "f"s, "c"s };
+        const auto contents = ring.Spans().first;
+        assert(std::equal(contents.begin(), contents.end(), expected.begin(), expected.end()));
+        RingBuffer<std::string> ring_copy(ring);
+        ring.PopBack();
+        assert(ring_copy.Size() == 5);
+        assert(ring_copy[4] == "c"s);
+    }
+    {
+        RingBuffer<int> window(3, RingBufferMode::OVERWRITE_OLDEST);
+        assert(window.Capacity() == 4);
+        for (int i = 0; i < 10; ++i) {
+            window.PushBack(i);
+        }
+        assert(window.Size() == 4);
+        assert(window.Capacity() == 4);
+        assert(window[0] == 6 && window[3] == 9);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            RingBuffer<Obj> ring(2, RingBufferMode::OVERWRITE_OLDEST);
+            ring.EmplaceBack(1);
+            ring.EmplaceBack(2);
+            ring.EmplaceBack(3);
+            assert(ring[0].id == 2 && ring[1].id == 3);
+            RingBuffer<Obj> growing;
+            for (int i = 0; i < 100; ++i) {
+                growing.EmplaceBack(i, "Ivan"s);
+            }
+            growing.Reserve(1000);
+            assert(growing.Capacity() == 1024);
+            assert(growing[99].id == 99);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test16() {
+    using namespace std::literals;
+    const size_t SIZE = 1000;
+    {
+        GapVector<char> text;
+        for (char c : "hello world"sv) {
+            text.PushBack(c);
+        }
+        text.MoveCursor(5);
+        text.Insert(5, ',');
+        assert(text.Cursor() == 6);
+        text.Insert(text.Size(), '?');
+        text.Erase(text.Size() - 1);
+        text.Insert(text.Size(), '!');
+        text.Erase(0);
+        text.Insert(0, 'H');
+        const Vector<char> contents = text.ToVector();
+        assert(std::string(contents.begin(), contents.end()) == "Hello, world!"s);
+    }
+    {
+        //        std::vector
+        GapVector<std::string> v;
+        std::vector<std::string> expected;
+        uint32_t seed = 42;
+        size_t cursor = 0;
+        for (size_t i = 0; i < SIZE * 5; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            cursor = std::min(expected.size(), cursor + (seed >> 10) % 5 - std::min<size_t>(cursor, 2));
+            if (seed % 3 == 0 && cursor < expected.size()) {
+                v.Erase(cursor);
+                expected.erase(expected.begin() + cursor);
+            }
+            else if (seed % 5 == 0 && !expected.empty()) {
+                v.Insert(cursor, v[expected.size() - 1]);
+                expected.insert(expected.begin() + cursor, std::string(expected.back()));
+            }
+            else {
+                v.EmplaceBack();
+                v.PopBack();
+                v.Insert(cursor, std::to_string(i));
+                expected.insert(expected.begin() + cursor, std::to_string(i));
+            }
+        }
+        assert(v.Size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(v[i] == expected[i]);
+        }
+        const GapVector<std::string> v_copy(v);
+        const Vector<std::string> moved = std::move(v).ToVector();
+        assert(std::equal(moved.begin(), moved.end(), expected.begin(), expected.end()));
+        assert(v_copy[v_copy.Size() - 1] == expected.back());
+    }
+    {
+        Obj::ResetCounters();
+        {
+            GapVector<Obj> v;
+            v.Reserve(SIZE);
+            for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+                v.EmplaceBack(i);
+            }
+            v.MoveCursor(0);
+            v.MoveCursor(SIZE / 2);
+            assert(v[SIZE / 2].id == static_cast<int>(SIZE / 2));
+            assert(Obj::GetAliveObjectCount() == static_cast<int>(SIZE));
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
     }
 }
 
+void Test17() {
+    using namespace std::literals;
+    const size_t SIZE = 5000;
+    {
+        //       std::vector,      
+        TieredVector<std::string> v;
+        std::vector<std::string> expected;
+        uint32_t seed = 7;
+        for (size_t i = 0; i < SIZE * 4; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const size_t pos = (seed >> 8) % (expected.size() + 1);
+            const bool shrinking = i >= SIZE * 3;
+            if ((shrinking || seed % 4 == 0) && pos < expected.size()) {
+                v.Erase(pos);
+                expected.erase(expected.begin() + pos);
+            }
+            else if (seed % 5 == 0 && !expected.empty()) {
+                v.Insert(pos, v[expected.size() - 1]);
+                expected.insert(expected.begin() + pos, std::string(expected.back()));
+            }
+            else {
+                v.Insert(pos, std::to_string(i));
+                expected.insert(expected.begin() + pos, std::to_string(i));
+            }
+            if (i == SIZE * 3) {
+                assert(v.BlockSize() > TieredVector<std::string>::MIN_BLOCK_SIZE);
+            }
+        }
+        assert(v.Size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(v[i] == expected[i]);
+        }
+        const TieredVector<std::string> v_copy(v);
+        while (v.Size() > 0) {
+            v.PopBack();
+        }
+        assert(v_copy.Size() == expected.size());
+    }
+    {
+        Obj::ResetCounters();
+        {
+            TieredVector<Obj> v;
+            for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+                v.EmplaceBack(i);
+            }
+            v.Emplace(0, -1);
+            v.Erase(SIZE / 2);
+            assert(v[0].id == -1);
+            assert(v[SIZE / 2].id == static_cast<int>(SIZE / 2));
+            assert(Obj::GetAliveObjectCount() == static_cast<int>(SIZE));
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test18() {
+    const size_t SIZE = 10000;
+    {
+        //        
+        PersistentVector<int> v;
+        Vector<PersistentVector<int>> versions;
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            if (i % 1000 == 0) {
+                versions.PushBack(v);
+            }
+            v = v.PushBack(i);
+        }
+        assert(v.Size() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i] == static_cast<int>(i));
+        }
+        for (size_t k = 0; k < versions.Size(); ++k) {
+            assert(versions[k].Size() == k * 1000);
+        }
+        const PersistentVector<int> updated = v.Set(SIZE / 2, -1);
+        assert(updated[SIZE / 2] == -1 && v[SIZE / 2] == static_cast<int>(SIZE / 2));
+    }
+    {
+        //       std::vector
+        std::vector<int> expected(SIZE);
+        std::iota(expected.begin(), expected.end(), 0);
+        Vector<int> source(SIZE);
+        std::iota(source.begin(), source.end(), 0);
+        PersistentVector<int> v = PersistentVector<int>::FromVector(source);
+        uint32_t seed = 3;
+        for (int round = 0; round < 300; ++round) {
+            seed = seed * 1664525u + 1013904223u;
+            const size_t begin = (seed >> 8) % (expected.size() + 1);
+            seed = seed * 1664525u + 1013904223u;
+            const size_t end = begin + (seed >> 8) % (expected.size() - begin + 1);
+            const PersistentVector<int> middle = v.Slice(begin, end);
+            v = v.Slice(0, begin).Concat(v.Slice(end, v.Size())).Concat(middle);
+            std::vector<int> middle_expected(expected.begin() + begin, expected.begin() + end);
+            expected.erase(expected.begin() + begin, expected.begin() + end);
+            expected.insert(expected.end(), middle_expected.begin(), middle_expected.end());
+            if (round % 10 == 0) {
+                v = v.PushBack(round).Set(0, round);
+                expected.push_back(round);
+                expected[0] = round;
+            }
+        }
+        assert(v.Size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(v[i] == expected[i]);
+        }
+        const Vector<int> flat = v.ToVector();
+        assert(std::equal(flat.begin(), flat.end(), expected.begin(), expected.end()));
+    }
+    {
+        // Builder     ,   
+        PersistentVector<std::string> base;
+        for (int i = 0; i < 100; ++i) {
+            base = base.PushBack(std::to_string(i));
+        }
+        PersistentVector<std::string>::Builder builder(base);
+        for (size_t i = 100; i < SIZE; ++i) {
+            builder.EmplaceBack(std::to_string(i));
+        }
+        const PersistentVector<std::string> built = std::move(builder).Build();
+        assert(base.Size() == 100 && built.Size() == SIZE);
+        size_t index = 0;
+        built.ForEach([&index](const std::string& value) {
+            assert(value == std::to_string(index));
+            ++index;
+            });
+        assert(index == SIZE);
+    }
+}
+
+void Test19() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        {
+            Vector<Obj> source;
+            for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+                source.EmplaceBack(i);
+            }
+            const Obj* address = &source[0];
+            CowVector<Obj> v(std::move(source));
+            CowVector<Obj> v_copy(v);
+            //   ,    
+            assert(v.IsShared() && &std::as_const(v_copy)[0] == address && Obj::num_copied == 0);
+            v_copy.EmplaceBack(std::as_const(v_copy)[0]);
+            assert(!v.IsShared() && !v_copy.IsShared());
+            assert(&std::as_const(v)[0] == address && &std::as_const(v_copy)[0] != address);
+            assert(Obj::num_copied == static_cast<int>(SIZE + 1));
+            assert(v.Size() == SIZE && v_copy.Size() == SIZE + 1 && v_copy[SIZE].id == 0);
+            //      
+            v[1].id = -1;
+            v.Erase(v.begin());
+            assert(&std::as_const(v)[0] == address && v[0].id == -1);
+            assert(v_copy[1].id == 1);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        Vector<std::string> source;
+        for (size_t i = 0; i < SIZE; ++i) {
+            source.PushBack(std::to_string(i));
+        }
+        const std::string* address = &source[0];
+        // Freeze      
+        const std::shared_ptr<const Vector<std::string>> frozen = std::move(source).Freeze();
+        assert(source.Size() == 0 && &(*frozen)[0] == address);
+        CowVector<std::string> v(frozen);
+        v[0] = "changed";
+        assert((*frozen)[0] == "0" && v[0] == "changed");
+        const std::shared_ptr<const Vector<std::string>> snapshot = v.Freeze();
+        v.PopBack();
+        assert(snapshot->Size() == SIZE && v.Size() == SIZE - 1);
+        CowVector<std::string> empty;
+        empty.PushBack("value");
+        assert(empty.Size() == 1 && CowVector<std::string>().Freeze()->Size() == 0);
+        //   CowVector    
+        CowVector<std::string> adopted(CowVector<std::string>().Freeze());
+        adopted.PushBack("value");
+        assert(adopted.Size() == 1 && !adopted.IsShared());
+    }
+}
+
+void Test20() {
+    const int SIZE = 10000;
+    {
+        Obj::ResetCounters();
+        {
+            Colony<Obj> colony;
+            Vector<Colony<Obj>::iterator> handles;
+            Vector<const Obj*> addresses;
+            for (int i = 0; i < SIZE; ++i) {
+                handles.PushBack(colony.Emplace(i));
+                addresses.PushBack(&*handles[i]);
+            }
+            const size_t capacity = colony.Capacity();
+            //    ,   
+            for (int i = 0; i < SIZE; i += 3) {
+                colony.Erase(handles[i]);
+            }
+            int sum = 0;
+            size_t count = 0;
+            for (const Obj& obj : colony) {
+                assert(obj.id % 3 != 0);
+                sum += obj.id;
+                ++count;
+            }
+            assert(count == colony.Size() && colony.Size() == static_cast<size_t>(SIZE - (SIZE + 2) / 3));
+            for (int i = 0; i < SIZE; ++i) {
+                if (i % 3 != 0) {
+                    assert(&*handles[i] == addresses[i] && handles[i]->id == i);
+                    sum -= i;
+                }
+            }
+            assert(sum == 0);
+            //       
+            for (int i = 0; i < SIZE; i += 3) {
+                colony.Emplace(-i);
+            }
+            assert(colony.Capacity() == capacity && colony.Size() == static_cast<size_t>(SIZE));
+            assert(Obj::GetAliveObjectCount() == SIZE);
+            const Colony<Obj> colony_copy(colony);
+            assert(colony_copy.Size() == colony.Size());
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //          
+        Colony<int> colony;
+        Vector<Colony<int>::iterator> handles;
+        long long expected_sum = 0;
+        uint32_t seed = 11;
+        for (int i = 0; i < SIZE * 10; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            if (handles.Size() > 0 && (seed >> 8) % 2 == 0) {
+                const size_t pos = (seed >> 9) % handles.Size();
+                expected_sum -= *handles[pos];
+                colony.Erase(handles[pos]);
+                handles[pos] = handles[handles.Size() - 1];
+                handles.PopBack();
+            }
+            else {
+                handles.PushBack(colony.Emplace(i));
+                expected_sum += i;
+            }
+        }
+        long long sum = 0;
+        size_t count = 0;
+        for (auto it = colony.begin(); it != colony.end(); ++it) {
+            sum += *it;
+            ++count;
+        }
+        assert(sum == expected_sum && count == handles.Size() && colony.Size() == count);
+        // Erase     ,     
+        for (auto it = colony.cbegin(); it != colony.cend();) {
+            it = colony.Erase(it);
+        }
+        assert(colony.Size() == 0 && colony.begin() == colony.end());
+    }
+}
+
+void Test21() {
+    const int SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        {
+            SlotMap<Obj> map;
+            Vector<SlotMap<Obj>::Handle> handles;
+            for (int i = 0; i < SIZE; ++i) {
+                handles.PushBack(map.Emplace(i));
+            }
+            assert(map.Size() == static_cast<size_t>(SIZE));
+            //       ,   
+            for (int i = 0; i < SIZE; i += 2) {
+                assert(map.Erase(handles[i]));
+            }
+            assert(map.Size() == static_cast<size_t>(SIZE / 2));
+            for (int i = 0; i < SIZE; ++i) {
+                if (i % 2 == 0) {
+                    assert(!map.Contains(handles[i]) && map.Find(handles[i]) == nullptr);
+                    assert(!map.Erase(handles[i]));
+                }
+                else {
+                    assert(map[handles[i]].id == i);
+                }
+            }
+            int sum = 0;
+            for (auto it = map.cbegin(); it != map.cend(); ++it) {
+                assert(map[map.HandleAt(it)].id == it->id);
+                sum += it->id;
+            }
+            assert(sum == SIZE * SIZE / 4);
+            //    ,    
+            const SlotMap<Obj>::Handle reused = map.Emplace(-1);
+            assert(reused.index == handles[SIZE - 2].index && reused.generation == 1);
+            assert(!map.Contains(handles[SIZE - 2]) && map[reused].id == -1);
+            assert(Obj::GetAliveObjectCount() == SIZE / 2 + 1);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //        
+        SlotMap<int> map;
+        Vector<SlotMap<int>::Handle> handles;
+        long long expected_sum = 0;
+        uint32_t seed = 5;
+        for (int i = 0; i < SIZE * 100; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            if (handles.Size() > 0 && (seed >> 8) % 2 == 0) {
+                const size_t pos = (seed >> 9) % handles.Size();
+                expected_sum -= map[handles[pos]];
+                assert(map.Erase(handles[pos]));
+                handles[pos] = handles[handles.Size() - 1];
+                handles.PopBack();
+            }
+            else {
+                handles.PushBack(map.Insert(i));
+                expected_sum += i;
+            }
+        }
+        assert(map.Size() == handles.Size());
+        assert(std::accumulate(map.begin(), map.end(), 0LL) == expected_sum);
+    }
+}
+
+void Test22() {
+    const uint32_t SIZE = 10000;
+    {
+        Obj::ResetCounters();
+        {
+            SparseSet<Obj> set;
+            //        
+            for (uint32_t key = 0; key < SIZE; ++key) {
+                set.Emplace(key * 7 + 1'000'000'000, static_cast<int>(key));
+            }
+            assert(set.Size() == SIZE && set.Emplace(1'000'000'000, -1).id == 0 && set.Size() == SIZE);
+            for (uint32_t key = 0; key < SIZE; key += 2) {
+                assert(set.Erase(key * 7 + 1'000'000'000));
+            }
+            assert(!set.Erase(1'000'000'000) && !set.Contains(0) && set.Find(SIZE) == nullptr);
+            for (uint32_t key = 0; key < SIZE; ++key) {
+                assert(set.Contains(key * 7 + 1'000'000'000) == (key % 2 == 1));
+            }
+            for (size_t i = 0; i < set.Size(); ++i) {
+                const uint32_t key = set.Keys()[i];
+                assert(&set[key] == set.begin() + i && (key - 1'000'000'000) / 7 == static_cast<uint32_t>(set[key].id));
+            }
+            assert(Obj::GetAliveObjectCount() == static_cast<int>(SIZE / 2));
+            set.Clear();
+            assert(set.Size() == 0 && !set.Contains(1'000'000'007) && Obj::GetAliveObjectCount() == 0);
+            set.Emplace(1'000'000'007, 1);
+            assert(set[1'000'000'007].id == 1);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //          
+        SparseSet<int> multiples_of_2;
+        SparseSet<std::string> multiples_of_3;
+        SparseSet<double> multiples_of_5;
+        for (uint32_t key = 0; key < SIZE; ++key) {
+            if (key % 2 == 0) {
+                multiples_of_2.Insert(key, static_cast<int>(key));
+            }
+            if (key % 3 == 0) {
+                multiples_of_3.Insert(key, std::to_string(key));
+            }
+            if (key % 5 == 0) {
+                multiples_of_5.Insert(key, key / 2.0);
+            }
+        }
+        size_t count = 0;
+        ForEachIntersection([&count](uint32_t key, int& a, const std::string& b, double& c) {
+            assert(key % 30 == 0 && a == static_cast<int>(key) && b == std::to_string(key) && c == key / 2.0);
+            a = -1;
+            ++count;
+            }, multiples_of_2, std::as_const(multiples_of_3), multiples_of_5);
+        assert(count == (SIZE + 29) / 30 && multiples_of_2[30] == -1 && multiples_of_2[2] == 2);
+        //    ,      
+        for (uint32_t key = 0; key < SIZE; key += 4) {
+            multiples_of_2.Erase(key);
+        }
+        Vector<uint32_t> keys;
+        ForEachIntersectionOrdered([&keys](uint32_t key, int& a, const std::string& b, double& c) {
+            assert(key % 60 == 30 && a == -1 && b == std::to_string(key) && c == key / 2.0);
+            keys.PushBack(key);
+            }, multiples_of_2, std::as_const(multiples_of_3), multiples_of_5);
+        assert(keys.Size() == (SIZE + 29) / 60 && std::is_sorted(keys.begin(), keys.end()));
+    }
+}
+
+void Test23() {
+    const int SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        {
+            IndexList<Obj> list;
+            for (int i = 0; i < SIZE; ++i) {
+                list.EmplaceBack(i);
+            }
+            //    
+            IndexList<Obj>::iterator middle = std::next(list.begin(), SIZE / 2);
+            for (int i = 1; i <= SIZE; ++i) {
+                list.EmplaceFront(-i);
+            }
+            assert(middle->id == SIZE / 2 && list.Front().id == -SIZE && list.Back().id == SIZE - 1);
+            list.Insert(middle, Obj(-1));
+            assert(std::prev(middle)->id == -1);
+            //    ,    
+            for (auto it = list.begin(); it != list.end();) {
+                it = it->id < 0 ? list.Erase(it) : std::next(it);
+            }
+            assert(list.Size() == static_cast<size_t>(SIZE) && list.Front().id == 0);
+            const size_t capacity = list.Capacity();
+            for (int i = 0; i < SIZE; ++i) {
+                list.EmplaceFront(SIZE + i);
+            }
+            assert(list.Capacity() == capacity && list.Front().id == 2 * SIZE - 1);
+            assert(Obj::GetAliveObjectCount() == 2 * SIZE);
+            const IndexList<Obj> list_copy(list);
+            //  Compact       
+            list.Compact();
+            assert(list.Capacity() == list.Size() && list.Size() == 2 * static_cast<size_t>(SIZE));
+            const char* first = reinterpret_cast<const char*>(&list.Front());
+            const ptrdiff_t stride = reinterpret_cast<const char*>(&*std::next(list.begin())) - first;
+            int expected = 2 * SIZE - 1;
+            auto copy_it = list_copy.begin();
+            for (const Obj& obj : list) {
+                assert(reinterpret_cast<const char*>(&obj) == first && obj.id == expected && copy_it->id == expected);
+                first += stride;
+                expected = expected == SIZE ? 0 : (expected > SIZE ? expected - 1 : expected + 1);
+                ++copy_it;
+            }
+            assert(copy_it == list_copy.end() && std::prev(list.end())->id == SIZE - 1);
+            list.PopBack();
+            list.PopFront();
+            assert(list.Back().id == SIZE - 2 && list.Front().id == 2 * SIZE - 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //       std::vector
+        IndexList<int> list;
+        std::vector<int> expected;
+        uint32_t seed = 7;
+        for (int i = 0; i < SIZE * 10; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            if (!expected.empty() && (seed >> 8) % 3 == 0) {
+                const size_t pos = (seed >> 10) % expected.size();
+                list.Erase(std::next(list.begin(), pos));
+                expected.erase(expected.begin() + pos);
+            }
+            else {
+                const size_t pos = (seed >> 10) % (expected.size() + 1);
+                list.Insert(std::next(list.begin(), pos), i);
+                expected.insert(expected.begin() + pos, i);
+            }
+            if (i % 1000 == 0) {
+                list.Compact();
+            }
+        }
+        assert(list.Size() == expected.size() && std::equal(list.begin(), list.end(), expected.begin()));
+    }
+}
+
+struct C {
+    C() noexcept {
+        ++def_ctor;
+    }
+    C(const C& /*other*/) noexcept {
+        ++copy_ctor;
+    }
+    C(C&& /*other*/) noexcept {
+        ++move_ctor;
+    }
+    C& operator=(const C& other) noexcept {
+        if (this != &other) {
+            ++copy_assign;
+        }
+        return *this;
+    }
+    C& operator=(C&& /*other*/) noexcept {
+        ++move_assign;
+        return *this;
+    }
+    ~C() {
+        ++dtor;
+    }
+
+    static void Reset() {
+        def_ctor = 0;
+        copy_ctor = 0;
+        move_ctor = 0;
+        copy_assign = 0;
+        move_assign = 0;
+        dtor = 0;
+    }
+
+    inline static size_t def_ctor = 0;
+    inline static size_t copy_ctor = 0;
+    inline static size_t move_ctor = 0;
+    inline static size_t copy_assign = 0;
+    inline static size_t move_assign = 0;
+    inline static size_t dtor = 0;
+};
+
+void Dump() {
+    using namespace std;
+    cerr << "Def ctors: "sv << C::def_ctor              //
+        << ", Copy ctors: "sv << C::copy_ctor          //
+        << ", Move ctors: "sv << C::move_ctor          //
+        << ", Copy assignments: "sv << C::copy_assign  //
+        << ", Move assignments: "sv << C::move_assign  //
+        << ", Dtors: "sv << C::dtor << endl;
+}
+
+void Benchmark() {
+    using namespace std;
+    try {
+        const size_t NUM = 10;
+        C c;
+        {
+            cerr << "std::vector:"sv << endl;
+            C::Reset();
+            vector<C> v(NUM);
+            Dump();
+            v.push_back(c);
+        }
+        Dump();
+    }
+    catch (...) {
+    }
+    try {
+        const size_t NUM = 10;
+        C c;
+        {
+            cerr << "Vector:"sv << endl;
+            C::Reset();
+            Vector<C> v(NUM);
+            Dump();
+            v.PushBack(c);
+        }
+        Dump();
+    }
+    catch (...) {
+    }
+}
+
+struct Particle {
+    float x = 0;
+    float y = 0;
+    float z = 0;
+    float vx = 0;
+    float vy = 0;
+    float vz = 0;
+    int32_t id = 0;
+    uint32_t flags = 0;
+};
+
+//   func  
+template <typename Func>
+double MeasureMs(Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Test24() {
+    const size_t SIZE = 16;
+    static_assert(std::is_trivially_copyable_v<InplaceVector<int, SIZE>>);
+    static_assert(std::is_trivially_copyable_v<InplaceVector<Particle, SIZE>>);
+    static_assert(!std::is_trivially_copyable_v<InplaceVector<std::string, SIZE>>);
+    static_assert(sizeof(InplaceVector<int, SIZE>) == sizeof(int) * SIZE + sizeof(size_t));
+    {
+        Obj::ResetCounters();
+        {
+            InplaceVector<Obj, SIZE> v;
+            for (int i = 0; i < static_cast<int>(SIZE) - 2; ++i) {
+                v.EmplaceBack(i);
+            }
+            v.Insert(v.begin(), Obj(-1));
+            //     ,   
+            v.Emplace(v.begin() + 1, v[1]);
+            assert(v.Size() == SIZE && v[0].id == -1 && v[1].id == 0 && v[2].id == 0 && v[SIZE - 1].id == SIZE - 3);
+            //    
+            assert(v.TryEmplaceBack(1) == nullptr && v.TryInsert(v.begin(), Obj(1)) == nullptr);
+            try {
+                v.EmplaceBack(1);
+                assert(false);
+            }
+            catch (const std::length_error&) {
+            }
+            assert(v.Size() == SIZE && Obj::GetAliveObjectCount() == static_cast<int>(SIZE));
+            v.Erase(v.begin() + 1);
+            assert(v[1].id == 0 && v[2].id == 1 && v.TryPushBack(Obj(100))->id == 100);
+            InplaceVector<Obj, SIZE> v_copy(v);
+            InplaceVector<Obj, SIZE> v_moved(std::move(v_copy));
+            v_copy.Resize(2);
+            v_copy = v_moved;
+            assert(v_copy.Size() == SIZE && v_copy[SIZE - 1].id == 100);
+            v_moved.Resize(1);
+            v_copy = std::move(v_moved);
+            assert(v_copy.Size() == 1 && v_copy[0].id == -1);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //      
+        InplaceVector<int, SIZE> v(3);
+        v[1] = 42;
+        v.PushBack(7);
+        unsigned char bytes[sizeof(v)];
+        std::memcpy(bytes, &v, sizeof(v));
+        InplaceVector<int, SIZE> received;
+        std::memcpy(&received, bytes, sizeof(received));
+        assert(received.Size() == 4 && received[0] == 0 && received[1] == 42 && received[3] == 7);
+        assert(std::accumulate(received.begin(), received.end(), 0) == 49);
+    }
+}
+
+//     limit,    
+constexpr Vector<int> BuildPrimes(int limit) {
+    Vector<int> primes;
+    for (int n = 2; n < limit; ++n) {
+        bool is_prime = true;
+        for (const int p : primes) {
+            if (n % p == 0) {
+                is_prime = false;
+                break;
+            }
+        }
+        if (is_prime) {
+            primes.PushBack(n);
+        }
+    }
+    return primes;
+}
+
+constexpr bool TestConstexprVector() {
+    Vector<int> v(3);
+    for (int i = 0; i < 10; ++i) {
+        v.PushBack(i * i);
+    }
+    v.Insert(v.begin(), -1);
+    v.Emplace(v.begin() + 2, -2);
+    v.Erase(v.begin() + 1);
+    v.Reserve(100);
+    Vector<int> v_copy(v);
+    v_copy.Resize(2);
+    v_copy = v;
+    Vector<int> v_moved(std::move(v));
+    v_moved.PopBack();
+    //    constexpr      
+    Vector<Vector<int>> nested;
+    for (int i = 0; i < 5; ++i) {
+        nested.EmplaceBack(static_cast<size_t>(i));
+    }
+    nested.Insert(nested.begin(), v_copy);
+    return v.Size() == 0 && v_moved.Size() == 13 && v_moved[0] == -1 && v_moved[1] == -2
+        && v_moved[2] == 0 && v_moved[12] == 64 && v_copy.Size() == 14 && v_copy[13] == 81
+        && v_moved.Capacity() == 100 && nested.Size() == 6 && nested[0].Size() == 14 && nested[5].Size() == 4;
+}
+
+void Test25() {
+    static_assert(TestConstexprVector());
+    static_assert(BuildPrimes(100).Size() == 25);
+    static constexpr auto PRIMES = MaterializeVector<[] { return BuildPrimes(1000); }>();
+    static_assert(std::is_same_v<decltype(PRIMES), const std::array<int, 168>>);
+    static_assert(PRIMES[0] == 2 && PRIMES[167] == 997);
+    //        
+    assert(TestConstexprVector());
+    const Vector<int> primes = BuildPrimes(1000);
+    assert(std::equal(primes.begin(), primes.end(), PRIMES.begin(), PRIMES.end()));
+}
+
+struct Shape {
+    virtual ~Shape() = default;
+    virtual double Area() const = 0;
+    virtual void Scale(double factor) = 0;
+};
+
+struct Square final : Shape {
+    explicit Square(double side)
+        : side(side) {
+    }
+    double Area() const override {
+        return side * side;
+    }
+    void Scale(double factor) override {
+        side *= factor;
+    }
+    double side;
+};
+
+struct Circle final : Shape {
+    explicit Circle(double radius)
+        : radius(radius) {
+    }
+    double Area() const override {
+        return 3 * radius * radius;
+    }
+    void Scale(double factor) override {
+        radius *= factor;
+    }
+    double radius;
+    std::string name = "circle";
+};
+
+//  : ,   Animal&,   Dog
+struct Animal {
+    virtual ~Animal() = default;
+    virtual int Legs() const {
+        return 0;
+    }
+};
+
+struct Dog : Animal {
+    int Legs() const override {
+        return 4;
+    }
+};
+
+template <typename Poly, typename Value>
+concept CanInsert = requires(Poly& poly, Value&& value) {
+    poly.Insert(std::forward<Value>(value));
+};
+
+void Test26() {
+    const int SIZE = 100;
+    PolyVector<Shape> shapes;
+    shapes.Register<Circle>(SIZE);
+    for (int i = 1; i <= SIZE; ++i) {
+        shapes.Emplace<Square>(i);
+        shapes.Insert(Circle(i));
+    }
+    assert(shapes.Size() == 2 * SIZE && shapes.SegmentCount() == 2);
+    assert(shapes.Size<Square>() == SIZE && shapes.Size<Circle>() == SIZE);
+    //   Base&      
+    double area = 0;
+    Vector<double> areas;
+    shapes.ForEach([&area, &areas](const Shape& shape) {
+        area += shape.Area();
+        areas.PushBack(shape.Area());
+        });
+    assert(area == 4.0 * SIZE * (SIZE + 1) * (2 * SIZE + 1) / 6);
+    assert(areas[0] == 3 && areas[SIZE] == 1);
+    shapes.ForEach<Square, Circle>([](auto& shape) {
+        shape.Scale(2);
+        });
+    double scaled_area = 0;
+    std::as_const(shapes).ForEach<Circle>([&scaled_area](const Circle& circle) {
+        assert(circle.name == "circle");
+        scaled_area += circle.Area();
+        });
+    assert(scaled_area == 3.0 * 4 * SIZE * (SIZE + 1) * (2 * SIZE + 1) / 6);
+    //      
+    const PolyVector<Shape> shapes_copy(shapes);
+    shapes.Erase<Square>(shapes.Objects<Square>().begin());
+    assert(shapes.Size() == 2 * SIZE - 1 && shapes.Objects<Square>()[0].side == 4);
+    assert(shapes_copy.Size() == 2 * SIZE && shapes_copy.Objects<Square>()[0].side == 2);
+    assert(shapes_copy.Objects<Circle>()[SIZE - 1].radius == 2 * SIZE && shapes_copy.Size<Shape>() == 0);
+    {
+        //  Base&  :      Base
+        static_assert(!CanInsert<PolyVector<Animal>, Animal&> && !CanInsert<PolyVector<Animal>, const Animal&>);
+        static_assert(CanInsert<PolyVector<Animal>, Dog&> && CanInsert<PolyVector<Animal>, Dog>);
+        PolyVector<Animal> animals;
+        Dog dog;
+        animals.Insert(dog);
+        animals.Emplace<Animal>();
+        int legs = 0;
+        animals.ForEach([&legs](const Animal& animal) {
+            legs += animal.Legs();
+            });
+        assert(legs == 4 && animals.Size<Dog>() == 1 && animals.Size<Animal>() == 1);
+    }
+}
+
+void Test27() {
+    const int SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        {
+            PointerVector<Obj> v;
+            Vector<const Obj*> addresses;
+            for (int i = 0; i < SIZE; ++i) {
+                addresses.PushBack(&v.EmplaceBack(i));
+            }
+            v.Insert(v.begin(), Obj(-1));
+            v.Emplace(v.begin() + 1, -2);
+            //      
+            assert(Obj::num_moved == 1 && Obj::num_copied == 0 && Obj::num_move_assigned == 0);
+            assert(v.Size() == SIZE + 2 && v[0].id == -1 && v[1].id == -2);
+            for (int i = 0; i < SIZE; ++i) {
+                assert(&v[i + 2] == addresses[i] && v[i + 2].id == i);
+            }
+            v.Erase(v.begin() + 1);
+            v.PopBack();
+            const size_t capacity = v.Capacity();
+            //     
+            const Obj& reused = v.EmplaceBack(SIZE);
+            assert(&reused == addresses[SIZE - 1]);
+            v.EmplaceBack(SIZE + 1);
+            assert(v.Capacity() == capacity && v.Size() == SIZE + 2);
+            int sum = 0;
+            v.ForEach([&sum](const Obj& obj) {
+                sum += obj.id;
+                });
+            assert(sum == -1 + (SIZE - 1) * (SIZE - 2) / 2 + SIZE + SIZE + 1);
+            const PointerVector<Obj> v_copy(v);
+            assert(v_copy.Size() == v.Size() && std::equal(v_copy.begin(), v_copy.end(), v.begin(),
+                [](const Obj& lhs, const Obj& rhs) { return lhs.id == rhs.id; }));
+            assert(Obj::GetAliveObjectCount() == 2 * (SIZE + 2));
+            v.Clear();
+            assert(v.Size() == 0 && v.Capacity() == 0 && Obj::GetAliveObjectCount() == SIZE + 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //  
+        struct Pinned {
+            explicit Pinned(int value)
+                : value(value) {
+            }
+            Pinned(const Pinned&) = delete;
+            Pinned& operator=(const Pinned&) = delete;
+            int value;
+        };
+        PointerVector<Pinned> v;
+        v.Reserve(SIZE);
+        assert(v.Capacity() == static_cast<size_t>(SIZE));
+        const Pinned* first = &v.EmplaceBack(0);
+        for (int i = 1; i < SIZE; ++i) {
+            v.Emplace(v.begin() + i / 2, i);
+        }
+        assert(&v[SIZE - 1] == first);
+        assert(v.Capacity() == static_cast<size_t>(SIZE) && v.Size() == static_cast<size_t>(SIZE));
+        std::vector<int> expected;
+        for (int i = 0; i < SIZE; ++i) {
+            expected.insert(expected.begin() + i / 2, i);
+        }
+        assert(std::equal(v.begin(), v.end(), expected.begin(), expected.end(),
+            [](const Pinned& lhs, int rhs) { return lhs.value == rhs; }));
+    }
+}
+
+void Test28() {
+    {
+        Obj::ResetCounters();
+        {
+            JaggedVector<Obj> rows;
+            Vector<Obj> row;
+            for (int i = 0; i < 10; ++i) {
+                rows.AppendRow({ row.begin(), row.Size() });
+                row.EmplaceBack(i);
+            }
+            assert(rows.RowCount() == 10 && rows.Size() == 45 && rows.Garbage() == 0);
+            for (size_t r = 0; r < rows.RowCount(); ++r) {
+                assert(rows.RowSize(r) == r && (r == 0 || rows[r][r - 1].id == static_cast<int>(r - 1)));
+            }
+            //     ,    
+            rows.EmplaceBack(9, 9);
+            assert(rows.Garbage() == 0 && rows[9].size() == 10);
+            rows.EmplaceBack(3, 100);
+            rows.EmplaceBack(3, 101);
+            assert(rows.Garbage() == 3 && rows[3].size() == 5 && rows[3][4].id == 101);
+            rows.Erase(5, 0);
+            rows.Erase(3, 1);
+            assert(rows.Garbage() == 4 && rows[5][0].id == 1 && rows[3][1].id == 2 && rows[3][3].id == 101);
+            assert(rows.Size() == 46 && Obj::GetAliveObjectCount() == 46 + 4 + 10);
+            const JaggedVector<Obj> copy(rows);
+            rows.Compact();
+            assert(rows.Garbage() == 0 && rows.Size() == 46 && Obj::GetAliveObjectCount() == 2 * 46 + 4 + 10);
+            //  Compact   
+            for (size_t r = 0; r + 1 < rows.RowCount(); ++r) {
+                assert(rows[r].size() == copy[r].size());
+                for (size_t i = 0; i < rows[r].size(); ++i) {
+                    assert(rows[r][i].id == copy[r][i].id);
+                }
+                if (rows[r].size() != 0) {
+                    assert(rows[r].data() + rows[r].size() == rows[r + 1].data());
+                }
+            }
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //          
+        const size_t ROWS = 1000;
+        Vector<std::pair<uint32_t, int>> pairs;
+        std::vector<std::vector<int>> expected(ROWS);
+        uint32_t seed = 9;
+        for (int i = 0; i < 20000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t row = (seed >> 8) % ROWS;
+            pairs.PushBack({ row, i });
+            expected[row].push_back(i);
+        }
+        JaggedVector<int, uint64_t> rows = JaggedVector<int, uint64_t>::FromPairs(ROWS, pairs);
+        assert(rows.RowCount() == ROWS && rows.Size() == pairs.Size());
+        for (size_t r = 0; r < ROWS; ++r) {
+            assert(std::equal(rows[r].begin(), rows[r].end(), expected[r].begin(), expected[r].end()));
+        }
+        rows.PushBack(0, -1);
+        rows.Erase(0, 0);
+        rows.AppendRow();
+        rows.PushBack(ROWS, 5);
+        rows.Compact();
+        assert(rows[0].back() == -1 && rows[0].size() == expected[0].size() && rows[ROWS][0] == 5);
+        assert(std::accumulate(rows[0].begin(), rows[0].end(), 0LL)
+            == std::accumulate(expected[0].begin() + 1, expected[0].end(), -1LL));
+    }
+    {
+        //         JaggedVector,    
+        //        
+        JaggedVector<std::string> rows;
+        rows.AppendRow({ std::string(40, 'a'), std::string(40, 'b') });
+        for (int i = 0; i < 8; ++i) {
+            rows.AppendRow(rows[rows.RowCount() - 1]);
+        }
+        assert(rows.RowCount() == 9 && rows.Size() == 18);
+        for (size_t r = 0; r < rows.RowCount(); ++r) {
+            assert(rows[r][0] == std::string(40, 'a') && rows[r][1] == std::string(40, 'b'));
+        }
+        for (int i = 0; i < 8; ++i) {
+            rows.PushBack(0, rows[0][0]);
+            rows.PushBack(4, rows[0][1]);
+        }
+        assert(rows.RowSize(0) == 10 && rows.RowSize(4) == 10 && rows.Garbage() != 0);
+        for (size_t i = 2; i < 10; ++i) {
+            assert(rows[0][i] == std::string(40, 'a') && rows[4][i] == std::string(40, 'b'));
+        }
+        rows.PushBack(8, rows[8][1]);
+        assert(rows[8].size() == 3 && rows[8][2] == std::string(40, 'b'));
+    }
+}
+
+void Test29() {
+    using namespace std::literals;
+    {
+        StringVector strings;
+        strings.PushBack("banana"sv);
+        strings.PushBack(""sv);
+        strings.Append(std::vector<std::string>{ "cherry", "apple", "date" });
+        const char* raw[] = { "fig", "elderberry" };
+        strings.Append(raw);
+        assert(strings.Size() == 7 && strings.CharCount() == 34 && strings[1].empty());
+        //     
+        assert(strings[0].data() + 6 == strings[2].data() && strings[6] == "elderberry"sv);
+        //       StringVector
+        strings.PushBack(strings[6].substr(0, 5));
+        strings.Set(0, strings[0].substr(3));
+        strings.Set(1, "grapefruit"sv);
+        assert(strings[7] == "elder"sv && strings[0] == "ana"sv && strings[1] == "grapefruit"sv);
+        assert(strings.Garbage() == 3 && strings.CharCount() == 34 + 5 - 3 + 10);
+        strings.Sort();
+        assert(std::is_sorted(strings.begin(), strings.end()) && strings[0] == "ana"sv && strings[7] == "grapefruit"sv);
+        const std::vector<std::string> sorted(strings.begin(), strings.end());
+        // Compact     
+        strings.Compact();
+        assert(strings.Garbage() == 0 && std::equal(strings.begin(), strings.end(), sorted.begin(), sorted.end()));
+        for (size_t i = 0; i + 1 < strings.Size(); ++i) {
+            assert(strings[i].data() + strings[i].size() == strings[i + 1].data());
+        }
+        strings.Sort(std::greater<>());
+        assert(strings[0] == "grapefruit"sv && strings[7] == "ana"sv);
+        strings.PopBack();
+        assert(strings.Size() == 7 && strings.Garbage() == 3 && strings.CharCount() == 43);
+        //     
+        const StringVector copy(strings);
+        assert(copy.Garbage() == 0 && std::equal(copy.begin(), copy.end(), strings.begin(), strings.end()));
+    }
+    {
+        // Append     StringVector,      
+        StringVector strings;
+        strings.PushBack("first"sv);
+        strings.PushBack("second"sv);
+        for (int i = 0; i < 10; ++i) {
+            strings.Append(std::array{ strings[0], strings[strings.Size() - 1] });
+        }
+        assert(strings.Size() == 22 && strings[20] == "first"sv && strings[21] == "second"sv);
+    }
+    {
+        //     std::vector<std::string>
+        StringVector strings;
+        std::vector<std::string> expected;
+        uint32_t seed = 13;
+        for (int i = 0; i < 10000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            std::string value = std::to_string(seed % 100000) + std::string((seed >> 20) % 10, 'x');
+            if (!expected.empty() && (seed >> 8) % 4 == 0) {
+                const size_t index = (seed >> 10) % expected.size();
+                strings.Set(index, value);
+                expected[index] = std::move(value);
+            }
+            else {
+                strings.PushBack(value);
+                expected.push_back(std::move(value));
+            }
+        }
+        strings.Sort();
+        std::sort(expected.begin(), expected.end());
+        strings.Compact();
+        assert(std::equal(strings.begin(), strings.end(), expected.begin(), expected.end()));
+    }
+}
+
+void Test30() {
+    using namespace std::literals;
+    {
+        InternPool pool;
+        assert(pool.Find("error"sv) == InternPool::NO_ID);
+        const uint32_t error = pool.Intern("error"sv);
+        const uint32_t warning = pool.Intern("warning"sv);
+        const uint32_t empty = pool.Intern(""sv);
+        //  ,     
+        assert(error == 0 && warning == 1 && empty == 2);
+        assert(pool.Intern(std::string("error")) == error && pool.Find("warning"sv) == warning);
+        assert(pool.Size() == 3 && pool.CharCount() == 12 && pool[empty].empty() && pool[warning] == "warning"sv);
+        assert(pool.Find("info"sv) == InternPool::NO_ID && pool.Size() == 3);
+        const std::vector<std::string> batch = { "info", "error", "info", "debug", "", "warning" };
+        const Vector<uint32_t> ids = pool.InternBatch(batch);
+        assert(ids.Size() == batch.size() && pool.Size() == 5);
+        assert(ids[0] == 3 && ids[1] == error && ids[2] == 3 && ids[3] == 4 && ids[4] == empty && ids[5] == warning);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            assert(pool[ids[i]] == batch[i]);
+        }
+    }
+    {
+        //       std::unordered_map
+        InternPool pool;
+        pool.Reserve(100, 1000);
+        std::unordered_map<std::string, uint32_t> expected;
+        uint32_t seed = 17;
+        //     100,    - 
+        for (int round = 0; round < 200; ++round) {
+            std::vector<std::string> batch;
+            for (int i = 0; i < 100; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                batch.push_back("s"s + std::to_string((seed >> 8) % 5000));
+                expected.emplace(batch.back(), static_cast<uint32_t>(expected.size()));
+            }
+            if (round % 2 == 0) {
+                const Vector<uint32_t> ids = pool.InternBatch(batch);
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    assert(ids[i] == expected.at(batch[i]));
+                }
+            }
+            else {
+                for (const std::string& value : batch) {
+                    assert(pool.Intern(value) == expected.at(value));
+                }
+            }
+        }
+        assert(pool.Size() == expected.size());
+        for (const auto& [value, id] : expected) {
+            assert(pool.Find(value) == id && pool[id] == value);
+        }
+    }
+}
+
+void Test31() {
+    using namespace std::literals;
+    {
+        //       
+        const std::vector<std::pair<std::string, int>> pairs = { {"pear", 1}, {"apple", 2}, {"pear", 3}, {"fig", 4} };
+        FlatMap<std::string, int> map = FlatMap<std::string, int>::FromPairs(pairs);
+        assert(map.Size() == 3 && map.Keys()[0] == "apple"s && map.Keys()[2] == "pear"s);
+        assert(map.Values()[2] == 1);
+        //    std::string
+        assert(*map.Find("fig"sv) == 4 && *map.Find("apple") == 2 && map.Find("kiwi"sv) == nullptr);
+        //     ,        
+        map.Insert("kiwi", 5);
+        map.Insert("kiwi", 6);
+        map.Insert("fig", 7);
+        assert(map.Size() == 4);
+        map.Emplace("banana"s, 8);
+        const FlatMap<std::string, int>& const_map = map;
+        assert(*const_map.Find("kiwi"sv) == 5 && const_map.Contains("banana"sv) && !const_map.Contains("plum"sv));
+        assert(std::is_sorted(map.Keys().begin(), map.Keys().end()));
+        map["plum"] = 9;
+        ++map["apple"];
+        assert(map.Size() == 6 && map.Values()[0] == 3 && *map.Find("plum"sv) == 9);
+        assert(map.Erase("fig"sv) && !map.Erase("fig"sv) && map.Size() == 5);
+        map.Append(std::vector<std::pair<std::string, int>>{ {"cherry", 10}, {"kiwi", 11} });
+        assert(map.Size() == 6 && *map.Find("cherry"sv) == 10 && *map.Find("kiwi"sv) == 5);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            FlatMap<int, Obj> map;
+            for (int i = 0; i < 100; ++i) {
+                map.Emplace((i * 37) % 100, i);
+            }
+            assert(map.Size() == 100 && Obj::GetAliveObjectCount() == 100);
+            assert(map.Find(74)->id == 2 && map.Erase(74));
+            assert(Obj::GetAliveObjectCount() == 99);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //  ,      std::map
+        FlatMap<uint32_t, uint32_t> map;
+        std::map<uint32_t, uint32_t> expected;
+        uint32_t seed = 19;
+        for (uint32_t i = 0; i < 20000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t key = (seed >> 8) % 5000;
+            switch ((seed >> 4) % 8) {
+            case 0:
+                assert(map.Erase(key) == (expected.erase(key) != 0));
+                break;
+            case 1: {
+                const auto it = expected.find(key);
+                const uint32_t* value = map.Find(key);
+                assert(it == expected.end() ? value == nullptr : *value == it->second);
+                break;
+            }
+            default: {
+                expected.emplace(key, i);
+                map.Insert(key, i);
+            }
+            }
+        }
+        assert(map.Size() == expected.size());
+        assert(std::equal(map.Keys().begin(), map.Keys().end(), expected.begin(), expected.end(),
+            [](uint32_t key, const auto& item) { return key == item.first; }));
+        size_t index = 0;
+        for (const auto& [key, value] : expected) {
+            assert(map.Values()[index++] == value);
+        }
+    }
+    {
+        FlatSet<std::string> set = FlatSet<std::string>::FromKeys(std::vector<std::string>{ "b", "a", "c", "a" });
+        assert(set.Size() == 3 && set.Contains("a"sv) && !set.Contains("d"sv));
+        set.Insert("d");
+        set.Insert("b");
+        set.Insert("d");
+        assert(set.Size() == 4);
+        assert(set.Erase("a"sv) && !set.Erase("a"sv));
+        const std::vector<std::string> expected = { "b", "c", "d" };
+        assert(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+    }
+    {
+        // FlatSet   std::set
+        FlatSet<uint32_t> set;
+        std::set<uint32_t> expected;
+        uint32_t seed = 23;
+        for (int i = 0; i < 20000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t key = (seed >> 8) % 3000;
+            if ((seed >> 4) % 4 == 0) {
+                assert(set.Erase(key) == (expected.erase(key) != 0));
+            }
+            else {
+                set.Insert(key);
+                expected.insert(key);
+            }
+            if (i % 1000 == 0) {
+                assert(set.Contains(key) == expected.contains(key));
+            }
+        }
+        assert(set.Size() == expected.size() && std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+    }
+}
+
+void BenchmarkSoa() {
+    using namespace std;
+    const size_t NUM = 2'000'000;
+    const int REPEAT = 10;
+
+    Vector<Particle> aos;
+    SoaVector<float, float, float, float, float, float, int32_t, uint32_t> soa;
+    aos.Reserve(NUM);
+    soa.Reserve(NUM);
+    for (size_t i = 0; i < NUM; ++i) {
+        const float value = static_cast<float>(i % 1000);
+        const uint32_t flags = static_cast<uint32_t>(i * 2654435761u) >> 28;
+        aos.PushBack(Particle{ value, value, value, value, value, value, static_cast<int32_t>(i), flags });
+        soa.PushBack(value, value, value, value, value, value, static_cast<int32_t>(i), flags);
+    }
+
+    double aos_sum = 0;
+    double soa_sum = 0;
+    const double aos_sum_ms = MeasureMs([&] {
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const Particle& p : aos) {
+                aos_sum += p.x;
+            }
+        }
+        });
+    const double soa_sum_ms = MeasureMs([&] {
+        for (int r = 0; r < REPEAT; ++r) {
+            for (float x : soa.Column<0>()) {
+                soa_sum += x;
+            }
+        }
+        });
+    assert(aos_sum == soa_sum);
+
+    double aos_filtered = 0;
+    double soa_filtered = 0;
+    const double aos_filter_ms = MeasureMs([&] {
+        for (int r = 0; r < REPEAT; ++r) {
+            for (const Particle& p : aos) {
+                if ((p.flags & 1) != 0) {
+                    aos_filtered += p.vx;
+                }
+            }
+        }
+        });
+    const double soa_filter_ms = MeasureMs([&] {
+        const auto flags = soa.Column<7>();
+        const auto vx = soa.Column<3>();
+        for (int r = 0; r < REPEAT; ++r) {
+            for (size_t i = 0; i < flags.size(); ++i) {
+                if ((flags[i] & 1) != 0) {
+                    soa_filtered += vx[i];
+                }
+            }
+        }
+        });
+    assert(aos_filtered == soa_filtered);
+
+    cerr << "AoS vs SoA, "sv << NUM << " rows x "sv << REPEAT << ":"sv << endl
+        << "  field sum: Vector<Particle> "sv << aos_sum_ms << " ms, SoaVector "sv << soa_sum_ms << " ms"sv << endl
+        << "  filter:    Vector<Particle> "sv << aos_filter_ms << " ms, SoaVector "sv << soa_filter_ms << " ms"sv << endl;
+}
+
+void BenchmarkTiered() {
+    using namespace std;
+    cerr << "Random inserts, TieredVector vs Vector:"sv << endl;
+    for (size_t num : { 10'000, 100'000, 1'000'000, 10'000'000 }) {
+        //    ,  Vector      
+        const size_t inserts = max<size_t>(100, 100'000'000 / num);
+        Vector<int> vector(num);
+        TieredVector<int> tiered;
+        for (size_t i = 0; i < num; ++i) {
+            tiered.PushBack(0);
+        }
+        uint32_t seed = 1;
+        const double vector_ms = MeasureMs([&] {
+            for (size_t i = 0; i < inserts; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                vector.Insert(vector.begin() + seed % (vector.Size() + 1), static_cast<int>(i));
+            }
+            });
+        seed = 1;
+        const double tiered_ms = MeasureMs([&] {
+            for (size_t i = 0; i < inserts; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                tiered.Insert(seed % (tiered.Size() + 1), static_cast<int>(i));
+            }
+            });
+        assert(vector[vector.Size() / 2] == tiered[tiered.Size() / 2]);
+        cerr << "  n = "sv << num << ", "sv << inserts << " inserts: Vector "sv << vector_ms
+            << " ms, TieredVector "sv << tiered_ms << " ms"sv << endl;
+    }
+}
+
+void BenchmarkColony() {
+    using namespace std;
+    //          
+    const size_t NUM = 100'000;
+    const size_t ROUNDS = 20;
+    const size_t CHURN = 1'000;
+    Vector<Particle> vector;
+    Colony<Particle> colony;
+    Vector<Colony<Particle>::iterator> handles;
+    for (size_t i = 0; i < NUM; ++i) {
+        vector.PushBack(Particle{ .id = static_cast<int32_t>(i) });
+        handles.PushBack(colony.Emplace(Particle{ .id = static_cast<int32_t>(i) }));
+    }
+    uint32_t seed = 1;
+    int64_t vector_sum = 0;
+    const double vector_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (size_t i = 0; i < CHURN; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                vector.Erase(vector.begin() + seed % vector.Size());
+                vector.PushBack(Particle{ .id = static_cast<int32_t>(i) });
+            }
+            for (const Particle& p : vector) {
+                vector_sum += p.id;
+            }
+        }
+        });
+    seed = 1;
+    int64_t colony_sum = 0;
+    const double colony_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (size_t i = 0; i < CHURN; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                Colony<Particle>::iterator& handle = handles[seed % handles.Size()];
+                colony.Erase(handle);
+                handle = colony.Emplace(Particle{ .id = static_cast<int32_t>(i) });
+            }
+            for (const Particle& p : colony) {
+                colony_sum += p.id;
+            }
+        }
+        });
+    cerr << "Churn, "sv << NUM << " objects, "sv << ROUNDS << " rounds x "sv << CHURN << " replacements:"sv << endl
+        << "  Vector "sv << vector_ms << " ms, Colony "sv << colony_ms << " ms"sv << endl;
+}
+
+void BenchmarkSparseSet() {
+    using namespace std;
+    //   ,     
+    const uint32_t NUM = 1'000'000;
+    const size_t ROUNDS = 20;
+    unordered_map<uint32_t, float> map_position;
+    unordered_map<uint32_t, float> map_velocity;
+    unordered_map<uint32_t, int> map_health;
+    SparseSet<float> position;
+    SparseSet<float> velocity;
+    SparseSet<int> health;
+    uint32_t seed = 1;
+    for (uint32_t entity = 0; entity < NUM; ++entity) {
+        seed = seed * 1664525u + 1013904223u;
+        map_position[entity] = position.Insert(entity, 0.0f);
+        if ((seed >> 8) % 2 == 0) {
+            map_velocity[entity] = velocity.Insert(entity, 1.0f);
+        }
+        if ((seed >> 9) % 4 == 0) {
+            map_health[entity] = health.Insert(entity, 1);
+        }
+    }
+    const double map_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (const auto& [entity, hp] : map_health) {
+                const auto it = map_velocity.find(entity);
+                if (it != map_velocity.end()) {
+                    map_position[entity] += it->second * hp;
+                }
+            }
+        }
+        });
+    const double sparse_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            ForEachIntersection([](uint32_t /*entity*/, float& p, const float& v, const int& hp) {
+                p += v * hp;
+                }, position, velocity, health);
+        }
+        });
+    assert(map_position[NUM - 1] == position[NUM - 1]);
+    cerr << "Join of 3 components, "sv << NUM << " entities, "sv << ROUNDS << " rounds:"sv << endl
+        << "  unordered_map "sv << map_ms << " ms, SparseSet "sv << sparse_ms << " ms"sv << endl;
+}
+
+void BenchmarkIndexList() {
+    using namespace std;
+    //      ,    
+    const size_t NUM = 100'000;
+    Vector<int> vector;
+    list<int> node_list;
+    IndexList<int> index_list;
+    Vector<list<int>::iterator> node_positions;
+    Vector<IndexList<int>::iterator> index_positions;
+    vector.PushBack(0);
+    node_positions.PushBack(node_list.insert(node_list.end(), 0));
+    index_positions.PushBack(index_list.Insert(index_list.end(), 0));
+    uint32_t seed = 1;
+    const double vector_ms = MeasureMs([&] {
+        for (size_t i = 1; i < NUM; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            vector.Insert(vector.begin() + seed % vector.Size(), static_cast<int>(i));
+        }
+        });
+    seed = 1;
+    const double node_list_ms = MeasureMs([&] {
+        for (size_t i = 1; i < NUM; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            node_positions.PushBack(node_list.insert(node_positions[seed % node_positions.Size()], static_cast<int>(i)));
+        }
+        });
+    seed = 1;
+    const double index_list_ms = MeasureMs([&] {
+        for (size_t i = 1; i < NUM; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            index_positions.PushBack(index_list.Insert(index_positions[seed % index_positions.Size()], static_cast<int>(i)));
+        }
+        });
+    const size_t ROUNDS = 100;
+    int64_t sum = 0;
+    const auto traverse = [&sum, ROUNDS](const auto& container) {
+        return MeasureMs([&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                for (const int value : container) {
+                    sum += value;
+                }
+            }
+            });
+        };
+    const double vector_traverse_ms = traverse(vector);
+    const double node_list_traverse_ms = traverse(node_list);
+    const double index_list_traverse_ms = traverse(index_list);
+    index_list.Compact();
+    const double compact_traverse_ms = traverse(index_list);
+    assert(sum == 4 * static_cast<int64_t>(ROUNDS) * static_cast<int64_t>(NUM * (NUM - 1) / 2));
+    cerr << "Inserts at known positions, "sv << NUM << " elements:"sv << endl
+        << "  insert:   Vector "sv << vector_ms << " ms, std::list "sv << node_list_ms
+        << " ms, IndexList "sv << index_list_ms << " ms"sv << endl
+        << "  traverse: Vector "sv << vector_traverse_ms << " ms, std::list "sv << node_list_traverse_ms
+        << " ms, IndexList "sv << index_list_traverse_ms << " ms, after Compact "sv << compact_traverse_ms << " ms"sv << endl;
+}
+
+void BenchmarkPolyVector() {
+    using namespace std;
+    //     ,    
+    const size_t NUM = 1'000'000;
+    const size_t ROUNDS = 20;
+    Vector<unique_ptr<Shape>> pointers;
+    PolyVector<Shape> shapes;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < NUM; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const double size = static_cast<double>(i % 100);
+        if ((seed >> 8) % 2 == 0) {
+            pointers.PushBack(make_unique<Square>(size));
+            shapes.Emplace<Square>(size);
+        }
+        else {
+            pointers.PushBack(make_unique<Circle>(size));
+            shapes.Emplace<Circle>(size);
+        }
+    }
+    //  ,       
+    for (size_t i = NUM - 1; i > 0; --i) {
+        seed = seed * 1664525u + 1013904223u;
+        swap(pointers[i], pointers[seed % (i + 1)]);
+    }
+    double pointers_area = 0;
+    const double pointers_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (const unique_ptr<Shape>& shape : pointers) {
+                pointers_area += shape->Area();
+            }
+        }
+        });
+    double base_area = 0;
+    const double base_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            shapes.ForEach([&base_area](const Shape& shape) {
+                base_area += shape.Area();
+                });
+        }
+        });
+    double typed_area = 0;
+    const double typed_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            shapes.ForEach<Square, Circle>([&typed_area](const auto& shape) {
+                typed_area += shape.Area();
+                });
+        }
+        });
+    assert(abs(pointers_area - base_area) < 1e-6 * base_area && abs(typed_area - base_area) < 1e-6 * base_area);
+    cerr << "Virtual call per object, "sv << NUM << " objects, "sv << ROUNDS << " rounds:"sv << endl
+        << "  Vector<unique_ptr> "sv << pointers_ms << " ms, PolyVector via Base& "sv << base_ms
+        << " ms, PolyVector by type "sv << typed_ms << " ms"sv << endl;
+}
+
+void BenchmarkPointerVector() {
+    using namespace std;
+    //  ,     
+    struct Record {
+        explicit Record(size_t id)
+            : id(id) {
+        }
+        size_t id;
+        char payload[504] = {};
+    };
+    const size_t NUM = 200'000;
+    Vector<Record> vector;
+    PointerVector<Record> pointer_vector;
+    const double vector_ms = MeasureMs([&] {
+        for (size_t i = 0; i < NUM; ++i) {
+            vector.EmplaceBack(i);
+        }
+        });
+    const double pointer_vector_ms = MeasureMs([&] {
+        for (size_t i = 0; i < NUM; ++i) {
+            pointer_vector.EmplaceBack(i);
+        }
+        });
+    //    ,        
+    const size_t SHUFFLED = 20'000;
+    PointerVector<Record> shuffled;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < SHUFFLED; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        shuffled.Emplace(shuffled.begin() + seed % (shuffled.Size() + 1), i);
+    }
+    const size_t ROUNDS = 100;
+    size_t plain_sum = 0;
+    const double plain_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (const Record& record : shuffled) {
+                plain_sum += record.id;
+            }
+        }
+        });
+    size_t prefetch_sum = 0;
+    const double prefetch_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            shuffled.ForEach([&prefetch_sum](const Record& record) {
+                prefetch_sum += record.id;
+                });
+        }
+        });
+    assert(plain_sum == prefetch_sum && plain_sum == ROUNDS * SHUFFLED * (SHUFFLED - 1) / 2);
+    cerr << "Growth with "sv << sizeof(Record) << "-byte objects, "sv << NUM << " elements:"sv << endl
+        << "  EmplaceBack: Vector "sv << vector_ms << " ms, PointerVector "sv << pointer_vector_ms << " ms"sv << endl
+        << "  "sv << ROUNDS << " traversals of "sv << SHUFFLED << " shuffled elements: iterator "sv << plain_ms << " ms, ForEach with prefetch "sv << prefetch_ms << " ms"sv << endl;
+}
+
+void BenchmarkJagged() {
+    using namespace std;
+    //    
+    const uint32_t VERTICES = 200'000;
+    const size_t EDGES = 2'000'000;
+    const size_t ROUNDS = 10;
+    Vector<pair<uint32_t, uint32_t>> edges;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < EDGES; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const uint32_t from = seed % VERTICES;
+        seed = seed * 1664525u + 1013904223u;
+        edges.PushBack({ from, seed % VERTICES });
+    }
+    Vector<Vector<uint32_t>> nested;
+    const double nested_build_ms = MeasureMs([&] {
+        nested.Resize(VERTICES);
+        for (const auto& [from, to] : edges) {
+            nested[from].PushBack(to);
+        }
+        });
+    JaggedVector<uint32_t> jagged;
+    const double jagged_build_ms = MeasureMs([&] {
+        jagged = JaggedVector<uint32_t>::FromPairs(VERTICES, edges);
+        });
+    uint64_t nested_sum = 0;
+    const double nested_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (uint32_t v = 0; v < VERTICES; ++v) {
+                for (const uint32_t to : nested[v]) {
+                    nested_sum += to;
+                }
+            }
+        }
+        });
+    uint64_t jagged_sum = 0;
+    const double jagged_ms = MeasureMs([&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (uint32_t v = 0; v < VERTICES; ++v) {
+                for (const uint32_t to : jagged[v]) {
+                    jagged_sum += to;
+                }
+            }
+        }
+        });
+    assert(nested_sum == jagged_sum);
+    cerr << "Adjacency lists, "sv << VERTICES << " vertices, "sv << EDGES << " edges:"sv << endl
+        << "  build:    Vector<Vector> "sv << nested_build_ms << " ms, JaggedVector::FromPairs "sv << jagged_build_ms << " ms"sv << endl
+        << "  traverse: Vector<Vector> "sv << nested_ms << " ms, JaggedVector "sv << jagged_ms << " ms"sv << endl;
+}
+
+void BenchmarkStringVector() {
+    using namespace std;
+    //    4  24 
+    const size_t NUM = 1'000'000;
+    Vector<string> keys;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < NUM; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        keys.PushBack("key_"s + to_string(seed) + string((seed >> 8) % 11, 'k'));
+    }
+    Vector<string> vector;
+    StringVector strings;
+    const double vector_build_ms = MeasureMs([&] {
+        for (const string& key : keys) {
+            vector.PushBack(key);
+        }
+        });
+    const double strings_build_ms = MeasureMs([&] {
+        strings.Append(keys);
+        });
+    //  :  std::string      
+    size_t vector_bytes = vector.Capacity() * sizeof(string);
+    for (const string& key : vector) {
+        vector_bytes += key.capacity() > 15 ? key.capacity() + 1 : 0;
+    }
+    const size_t strings_bytes = strings.CharCount() + strings.Size() * 2 * sizeof(uint32_t);
+    size_t vector_count = 0;
+    const double vector_scan_ms = MeasureMs([&] {
+        for (const string& key : vector) {
+            vector_count += key.ends_with('7');
+        }
+        });
+    size_t strings_count = 0;
+    const double strings_scan_ms = MeasureMs([&] {
+        for (const string_view key : strings) {
+            strings_count += key.ends_with('7');
+        }
+        });
+    const double vector_sort_ms = MeasureMs([&] {
+        sort(vector.begin(), vector.end());
+        });
+    const double strings_sort_ms = MeasureMs([&] {
+        strings.Sort();
+        strings.Compact();
+        });
+    assert(vector_count == strings_count && vector[NUM / 2] == strings[NUM / 2]);
+    cerr << "Short keys, "sv << NUM << " strings:"sv << endl
+        << "  memory: Vector<string> ~"sv << vector_bytes / 1024 << " KiB, StringVector ~"sv << strings_bytes / 1024 << " KiB"sv << endl
+        << "  build:  Vector<string> "sv << vector_build_ms << " ms, StringVector "sv << strings_build_ms << " ms"sv << endl
+        << "  scan:   Vector<string> "sv << vector_scan_ms << " ms, StringVector "sv << strings_scan_ms << " ms"sv << endl
+        << "  sort:   Vector<string> "sv << vector_sort_ms << " ms, StringVector with Compact "sv << strings_sort_ms << " ms"sv << endl;
+}
+
+void BenchmarkInternPool() {
+    using namespace std;
+    //   : 2      50  
+    const size_t NUM = 2'000'000;
+    const uint32_t DICTIONARY = 50'000;
+    Vector<string> tokens;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < NUM; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        tokens.PushBack("token_"s + to_string((seed >> 8) % DICTIONARY));
+    }
+    unordered_map<string, uint32_t> map;
+    Vector<uint32_t> map_ids;
+    map_ids.Reserve(NUM);
+    const double map_ms = MeasureMs([&] {
+        for (const string& token : tokens) {
+            map_ids.PushBack(map.emplace(token, static_cast<uint32_t>(map.size())).first->second);
+        }
+        });
+    InternPool pool;
+    Vector<uint32_t> pool_ids;
+    pool_ids.Reserve(NUM);
+    const double pool_ms = MeasureMs([&] {
+        for (const string& token : tokens) {
+            pool_ids.PushBack(pool.Intern(token));
+        }
+        });
+    InternPool batch_pool;
+    Vector<uint32_t> batch_ids;
+    const double batch_ms = MeasureMs([&] {
+        batch_ids = batch_pool.InternBatch(tokens);
+        });
+    assert(map.size() == pool.Size() && batch_pool.Size() == pool.Size());
+    assert(equal(map_ids.begin(), map_ids.end(), pool_ids.begin()) && equal(pool_ids.begin(), pool_ids.end(), batch_ids.begin()));
+    cerr << "Interning "sv << NUM << " tokens, "sv << pool.Size() << " distinct:"sv << endl
+        << "  unordered_map<string, uint32_t> "sv << map_ms << " ms"sv << endl
+        << "  InternPool::Intern "sv << pool_ms << " ms, InternPool::InternBatch "sv << batch_ms << " ms"sv << endl;
+}
+
+void BenchmarkFlatMap() {
+    using namespace std;
+    const size_t NUM = 500'000;
+    const size_t LOOKUPS = 5'000'000;
+    Vector<pair<uint64_t, uint64_t>> pairs;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < NUM; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        pairs.PushBack({ seed, i });
+    }
+    map<uint64_t, uint64_t> tree;
+    unordered_map<uint64_t, uint64_t> hash;
+    FlatMap<uint64_t, uint64_t> flat;
+    const double tree_insert_ms = MeasureMs([&] {
+        for (const auto& [key, value] : pairs) {
+            tree.emplace(key, value);
+        }
+        });
+    const double hash_insert_ms = MeasureMs([&] {
+        for (const auto& [key, value] : pairs) {
+            hash.emplace(key, value);
+        }
+        });
+    const double flat_insert_ms = MeasureMs([&] {
+        for (const auto& [key, value] : pairs) {
+            flat.Insert(key, value);
+        }
+        flat.Size();
+        });
+    FlatMap<uint64_t, uint64_t> bulk;
+    const double flat_bulk_ms = MeasureMs([&] {
+        bulk = FlatMap<uint64_t, uint64_t>::FromPairs(pairs);
+        });
+    //      
+    Vector<uint64_t> queries;
+    for (size_t i = 0; i < LOOKUPS; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        queries.PushBack(i % 2 == 0 ? pairs[seed % NUM].first : seed);
+    }
+    uint64_t tree_sum = 0;
+    const double tree_lookup_ms = MeasureMs([&] {
+        for (const uint64_t key : queries) {
+            const auto it = tree.find(key);
+            tree_sum += it == tree.end() ? 0 : it->second;
+        }
+        });
+    uint64_t hash_sum = 0;
+    const double hash_lookup_ms = MeasureMs([&] {
+        for (const uint64_t key : queries) {
+            const auto it = hash.find(key);
+            hash_sum += it == hash.end() ? 0 : it->second;
+        }
+        });
+    uint64_t flat_sum = 0;
+    const double flat_lookup_ms = MeasureMs([&] {
+        for (const uint64_t key : queries) {
+            const uint64_t* value = flat.Find(key);
+            flat_sum += value == nullptr ? 0 : *value;
+        }
+        });
+    assert(tree.size() == flat.Size() && bulk.Size() == flat.Size() && tree_sum == flat_sum && hash_sum == flat_sum);
+    cerr << "Lookup tables, "sv << NUM << " keys, "sv << LOOKUPS << " lookups:"sv << endl
+        << "  insert: std::map "sv << tree_insert_ms << " ms, std::unordered_map "sv << hash_insert_ms
+        << " ms, FlatMap "sv << flat_insert_ms << " ms, FlatMap::FromPairs "sv << flat_bulk_ms << " ms"sv << endl
+        << "  lookup: std::map "sv << tree_lookup_ms << " ms, std::unordered_map "sv << hash_lookup_ms
+        << " ms, FlatMap "sv << flat_lookup_ms << " ms"sv << endl;
+}
+
 int main() {
     try {
         Test1();
@@ -654,7 +2949,43 @@ int main() {
         Test4();
         Test5();
         Test6();
+        Test7();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
+        Test29();
+        Test30();
+        Test31();
         Benchmark();
+        BenchmarkSoa();
+        BenchmarkTiered();
+        BenchmarkColony();
+        BenchmarkSparseSet();
+        BenchmarkIndexList();
+        BenchmarkPolyVector();
+        BenchmarkPointerVector();
+        BenchmarkJagged();
+        BenchmarkStringVector();
+        BenchmarkInternPool();
+        BenchmarkFlatMap();
     }
     catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,329 @@
+#pragma once
+
+#include "vector.h"
+
+//     .      ,
+//      RawMemory  .
+//  ThinVector      nullptr
+template <typename T>
+class ThinVector {
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept {
+        return data_;
+    }
+
+    iterator end() noexcept {
+        return data_ + Size();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    const_iterator end() const noexcept {
+        return data_ + Size();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    ThinVector() = default;
+
+    explicit ThinVector(size_t size) {
+        if (size == 0) {
+            return;
+        }
+        Block block = AllocateBlock(size);
+        std::uninitialized_value_construct_n(Elements(block), size);
+        Adopt(block, size);
+    }
+
+    ThinVector(const ThinVector& other) {
+        if (other.Size() == 0) {
+            return;
+        }
+        Block block = AllocateBlock(other.Size());
+        std::uninitialized_copy_n(other.data_, other.Size(), Elements(block));
+        Adopt(block, other.Size());
+    }
+
+    ThinVector(ThinVector&& other) noexcept {
+        Swap(other);
+    }
+
+    ThinVector& operator=(const ThinVector& rhs) {
+        if (this != &rhs) {
+            const size_t size = Size();
+            const size_t rhs_size = rhs.Size();
+            if (rhs_size > Capacity()) {
+                ThinVector rhs_copy(rhs);
+                Swap(rhs_copy);
+            }
+            else {
+                size_t copy_size{};
+                if (rhs_size <= size) {
+                    copy_size = rhs_size;
+                    std::destroy_n(data_ + rhs_size, size - rhs_size);
+                }
+                else {
+                    copy_size = size;
+                    std::uninitialized_copy_n(rhs.data_ + size, rhs_size - size, data_ + size);
+                }
+
+                std::copy_n(rhs.data_, copy_size, data_);
+                SetSize(rhs_size);
+            }
+        }
+        return *this;
+    }
+
+    ThinVector& operator=(ThinVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(ThinVector& other) noexcept {
+        std::swap(data_, other.data_);
+    }
+
+    ~ThinVector() {
+        std::destroy_n(data_, Size());
+        Block block = TakeBlock();
+    }
+
+    size_t Size() const noexcept {
+        return data_ != nullptr ? GetHeader()->size : 0;
+    }
+
+    size_t Capacity() const noexcept {
+        return data_ != nullptr ? GetHeader()->capacity : 0;
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        Block new_block = AllocateBlock(new_capacity);
+
+        MoveOrCopyData(new_block);
+
+        Replace(new_block);
+    }
+
+    void Resize(size_t new_size) {
+        const size_t size = Size();
+        if (new_size < size) {
+            std::destroy_n(data_ + new_size, size - new_size);
+        }
+        else {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(data_ + size, new_size - size);
+        }
+        SetSize(new_size);
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        const size_t size = Size();
+        T* value_ = nullptr;
+        if (size == Capacity()) {
+            Block new_block = AllocateBlock(size == 0 ? 1 : size * 2);
+            value_ = new (Elements(new_block) + size) T(std::forward <Args>(args) ...);
+
+            MoveOrCopyData(new_block);
+
+            Replace(new_block);
+        }
+        else {
+            value_ = new (data_ + size) T(std::forward <Args>(args) ...);
+        }
+        SetSize(size + 1);
+        return *value_;
+    }
+
+    void PopBack() noexcept {
+        std::destroy_at(end() - 1);
+        SetSize(Size() - 1);
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        if (Size() == Capacity()) {
+            return EmplaceRealloc(pos, std::forward <Args>(args) ...);
+        }
+        return EmplaceMove(pos, std::forward <Args>(args) ...);
+    }
+
+    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        iterator pos_ = const_cast<iterator>(pos);
+        std::move(pos_ + 1, end(), pos_);
+        PopBack();
+        return pos_;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<ThinVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < Size());
+        return data_[index];
+    }
+
+private:
+    struct Header {
+        size_t size;
+        size_t capacity;
+    };
+
+    //      T,    
+    static constexpr size_t HEADER_SLOTS = (sizeof(Header) + sizeof(T) - 1) / sizeof(T);
+    using Block = RawMemory<T, PagePolicy<>, std::max(alignof(T), alignof(Header))>;
+
+    T* data_ = nullptr;
+
+    static T* Elements(Block& block) noexcept {
+        return block.GetAddress() + HEADER_SLOTS;
+    }
+
+    static Header* GetHeader(Block& block) noexcept {
+        return reinterpret_cast<Header*>(block.GetAddress());
+    }
+
+    Header* GetHeader() const noexcept {
+        return reinterpret_cast<Header*>(data_ - HEADER_SLOTS);
+    }
+
+    void SetSize(size_t size) noexcept {
+        if (data_ != nullptr) {
+            GetHeader()->size = size;
+        }
+    }
+
+    //    capacity     
+    static Block AllocateBlock(size_t capacity) {
+        Block block(capacity + HEADER_SLOTS);
+        new (GetHeader(block)) Header{ 0, capacity };
+        return block;
+    }
+
+    //    .     
+    void Adopt(Block& block, size_t size) noexcept {
+        assert(data_ == nullptr);
+        GetHeader(block)->size = size;
+        data_ = block.Release() + HEADER_SLOTS;
+    }
+
+    //   ,        RawMemory
+    Block TakeBlock() noexcept {
+        if (data_ == nullptr) {
+            return Block();
+        }
+        const size_t capacity = GetHeader()->capacity;
+        return Block(std::exchange(data_, nullptr) - HEADER_SLOTS, capacity + HEADER_SLOTS);
+    }
+
+    //    ,    new_block,    
+    void Replace(Block& new_block) noexcept {
+        const size_t size = Size();
+        std::destroy_n(data_, size);
+        Block old_block = TakeBlock();
+        Adopt(new_block, size);
+    }
+
+    void MoveOrCopyData(Block& new_block) {
+        // constexpr  if     
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(data_, Size(), Elements(new_block));
+        }
+        else {
+            std::uninitialized_copy_n(data_, Size(), Elements(new_block));
+        }
+    }
+
+    template <typename... Args>
+    iterator EmplaceRealloc(const_iterator pos, Args&&... args) {
+        const size_t size = Size();
+        size_t index_ = pos - begin();
+        iterator value_ptr = nullptr;
+
+        Block new_block = AllocateBlock(size == 0 ? 1 : size * 2);
+        T* new_data = Elements(new_block);
+        value_ptr = new (new_data + index_) T(std::forward <Args>(args) ...);
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(begin(), index_, new_data);
+            std::uninitialized_move_n(begin() + index_, size - index_, new_data + index_ + 1);
+        }
+        else {
+            try {
+                std::uninitialized_copy_n(begin(), index_, new_data);
+            }
+            catch (...) {
+                std::destroy_at(new_data + index_);
+                throw;
+            }
+            try {
+                std::uninitialized_copy_n(begin() + index_, size - index_, new_data + index_ + 1);
+            }
+            catch (...) {
+                std::destroy_n(new_data, index_ + 1);
+                throw;
+            }
+        }
+        Replace(new_block);
+
+        SetSize(size + 1);
+        return value_ptr;
+    }
+
+    template <typename... Args>
+    iterator EmplaceMove(const_iterator pos, Args&&... args) {
+        size_t index_ = pos - begin();
+        iterator value_ptr = begin() + index_;
+
+        if (value_ptr == end()) {
+            new (value_ptr) T(std::forward <Args>(args) ...);
+        }
+        else {
+            //      ,   
+            //    
+            T value(std::forward <Args>(args) ...);
+            new (end()) T(std::move(*(end() - 1)));
+            try {
+                std::move_backward(value_ptr, end() - 1, end());
+                *value_ptr = std::move(value);
+            }
+            catch (...) {
+                std::destroy_at(end());
+                throw;
+            }
+        }
+
+        SetSize(Size() + 1);
+        return value_ptr;
+    }
+};
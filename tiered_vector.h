@@ -0,0 +1,331 @@
+#pragma once
+
+#include "vector.h"
+
+#include <bit>
+
+//   (tiered vector):       B,
+//   -  .  ,  ,  , 
+//   O(1):          .
+//           ,
+//          ,    
+// O(B + n / B) = O(sqrt(n)) . B   sqrt(n)
+template <typename T>
+class TieredVector {
+public:
+    static constexpr size_t MIN_BLOCK_SIZE = 16;
+
+    TieredVector() = default;
+
+    TieredVector(const TieredVector& other)
+        : block_shift_(other.block_shift_) {
+        blocks_.Reserve(other.blocks_.Size());
+        for (const Block& block : other.blocks_) {
+            blocks_.PushBack(block);
+        }
+        size_ = other.size_;
+    }
+
+    TieredVector(TieredVector&& other) noexcept {
+        Swap(other);
+    }
+
+    TieredVector& operator=(const TieredVector& rhs) {
+        if (this != &rhs) {
+            TieredVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    TieredVector& operator=(TieredVector&& rhs) noexcept {
+        Swap(rhs);
+        return *this;
+    }
+
+    void Swap(TieredVector& other) noexcept {
+        blocks_.Swap(other.blocks_);
+        std::swap(block_shift_, other.block_shift_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t BlockSize() const noexcept {
+        return size_t{ 1 } << block_shift_;
+    }
+
+    void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        return Emplace(size_, std::forward <Args>(args) ...);
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        blocks_[blocks_.Size() - 1].PopBack();
+        --size_;
+        DropEmptyLastBlock();
+    }
+
+    //     index  O(sqrt(n)) 
+    template <typename... Args>
+    T& Emplace(size_t index, Args&&... args) {
+        assert(index <= size_);
+        if (size_ == blocks_.Size() * BlockSize()) {
+            if (blocks_.Size() == 2 * BlockSize()) {
+                //    ,    
+                T value(std::forward <Args>(args) ...);
+                Rebuild(block_shift_ + 1);
+                return Emplace(index, std::move(value));
+            }
+            blocks_.EmplaceBack(BlockSize());
+        }
+        const size_t block_index = index >> block_shift_;
+        const size_t last = blocks_.Size() - 1;
+        if (block_index == last) {
+            ++size_;
+            return blocks_[last].Emplace(index & Mask(), std::forward <Args>(args) ...);
+        }
+        //     ,      
+        T value(std::forward <Args>(args) ...);
+        for (size_t i = last; i > block_index; --i) {
+            blocks_[i].EmplaceFront(std::move(blocks_[i - 1].Back()));
+            blocks_[i - 1].PopBack();
+        }
+        ++size_;
+        return blocks_[block_index].Emplace(index & Mask(), std::move(value));
+    }
+
+    void Insert(size_t index, const T& value) {
+        Emplace(index, value);
+    }
+
+    void Insert(size_t index, T&& value) {
+        Emplace(index, std::move(value));
+    }
+
+    //   index  O(sqrt(n)) 
+    void Erase(size_t index) {
+        assert(index < size_);
+        const size_t block_index = index >> block_shift_;
+        blocks_[block_index].Erase(index & Mask());
+        for (size_t i = block_index + 1; i < blocks_.Size(); ++i) {
+            blocks_[i - 1].EmplaceBack(std::move(blocks_[i].Front()));
+            blocks_[i].PopFront();
+        }
+        --size_;
+        DropEmptyLastBlock();
+        if (block_shift_ > MIN_BLOCK_SHIFT && blocks_.Size() * 8 < BlockSize()) {
+            Rebuild(block_shift_ - 1);
+        }
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<TieredVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return blocks_[index >> block_shift_][index & Mask()];
+    }
+
+private:
+    //     -  
+    class Block {
+    public:
+        explicit Block(size_t capacity)
+            : data_(capacity) {
+        }
+
+        Block(const Block& other)
+            : data_(other.data_.Capacity()) {
+            try {
+                for (; size_ < other.size_; ++size_) {
+                    new (Slot(size_)) T(other[size_]);
+                }
+            }
+            catch (...) {
+                while (size_ > 0) {
+                    PopBack();
+                }
+                throw;
+            }
+        }
+
+        Block(Block&& other) noexcept {
+            Swap(other);
+        }
+
+        Block& operator=(Block&& rhs) noexcept {
+            Swap(rhs);
+            return *this;
+        }
+
+        void Swap(Block& other) noexcept {
+            data_.Swap(other.data_);
+            std::swap(head_, other.head_);
+            std::swap(size_, other.size_);
+        }
+
+        ~Block() {
+            while (size_ > 0) {
+                PopBack();
+            }
+        }
+
+        size_t Size() const noexcept {
+            return size_;
+        }
+
+        T& Front() noexcept {
+            return (*this)[0];
+        }
+
+        T& Back() noexcept {
+            return (*this)[size_ - 1];
+        }
+
+        template <typename... Args>
+        T& EmplaceBack(Args&&... args) {
+            assert(size_ < data_.Capacity());
+            T* value = new (Slot(size_)) T(std::forward <Args>(args) ...);
+            ++size_;
+            return *value;
+        }
+
+        template <typename... Args>
+        T& EmplaceFront(Args&&... args) {
+            assert(size_ < data_.Capacity());
+            const size_t new_head = (head_ - 1) & Mask();
+            T* value = new (data_ + new_head) T(std::forward <Args>(args) ...);
+            head_ = new_head;
+            ++size_;
+            return *value;
+        }
+
+        void PopBack() noexcept {
+            --size_;
+            std::destroy_at(Slot(size_));
+        }
+
+        void PopFront() noexcept {
+            std::destroy_at(Slot(0));
+            head_ = (head_ + 1) & Mask();
+            --size_;
+        }
+
+        //     pos,     
+        template <typename... Args>
+        T& Emplace(size_t pos, Args&&... args) {
+            assert(pos <= size_);
+            if (pos == size_) {
+                return EmplaceBack(std::forward <Args>(args) ...);
+            }
+            if (pos == 0) {
+                return EmplaceFront(std::forward <Args>(args) ...);
+            }
+            T value(std::forward <Args>(args) ...);
+            if (pos < size_ - pos) {
+                EmplaceFront(std::move(Front()));
+                for (size_t i = 1; i < pos; ++i) {
+                    (*this)[i] = std::move((*this)[i + 1]);
+                }
+            }
+            else {
+                EmplaceBack(std::move(Back()));
+                for (size_t i = size_ - 2; i > pos; --i) {
+                    (*this)[i] = std::move((*this)[i - 1]);
+                }
+            }
+            T& slot = (*this)[pos];
+            slot = std::move(value);
+            return slot;
+        }
+
+        //   pos,     
+        void Erase(size_t pos) {
+            assert(pos < size_);
+            if (pos < size_ - pos) {
+                for (size_t i = pos; i > 0; --i) {
+                    (*this)[i] = std::move((*this)[i - 1]);
+                }
+                PopFront();
+            }
+            else {
+                for (size_t i = pos; i + 1 < size_; ++i) {
+                    (*this)[i] = std::move((*this)[i + 1]);
+                }
+                PopBack();
+            }
+        }
+
+        T& operator[](size_t index) noexcept {
+            assert(index < size_);
+            return *Slot(index);
+        }
+
+        const T& operator[](size_t index) const noexcept {
+            return const_cast<Block&>(*this)[index];
+        }
+
+    private:
+        RawMemory<T> data_;
+        size_t head_ = 0;
+        size_t size_ = 0;
+
+        size_t Mask() const noexcept {
+            return data_.Capacity() - 1;
+        }
+
+        T* Slot(size_t index) noexcept {
+            return data_ + ((head_ + index) & Mask());
+        }
+    };
+
+    static constexpr size_t MIN_BLOCK_SHIFT = std::bit_width(MIN_BLOCK_SIZE) - 1;
+
+    Vector<Block> blocks_;
+    size_t block_shift_ = MIN_BLOCK_SHIFT;
+    size_t size_ = 0;
+
+    size_t Mask() const noexcept {
+        return BlockSize() - 1;
+    }
+
+    void DropEmptyLastBlock() noexcept {
+        if (blocks_.Size() > 0 && blocks_[blocks_.Size() - 1].Size() == 0) {
+            blocks_.PopBack();
+        }
+    }
+
+    //      2^new_shift
+    void Rebuild(size_t new_shift) {
+        const size_t new_block_size = size_t{ 1 } << new_shift;
+        Vector<Block> new_blocks;
+        new_blocks.Reserve((size_ + new_block_size - 1) / new_block_size);
+        for (size_t i = 0; i < size_; ++i) {
+            if ((i & (new_block_size - 1)) == 0) {
+                new_blocks.EmplaceBack(new_block_size);
+            }
+            // constexpr  if     
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                new_blocks[new_blocks.Size() - 1].EmplaceBack(std::move((*this)[i]));
+            }
+            else {
+                new_blocks[new_blocks.Size() - 1].EmplaceBack((*this)[i]);
+            }
+        }
+        blocks_.Swap(new_blocks);
+        block_shift_ = new_shift;
+    }
+};
@@ -7,125 +7,331 @@
 #include <memory>
 #include <type_traits>
 #include <algorithm>
+#include <cstdint>
+#include <array>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+//     ,   RawMemory.
+// Prefault -       ,  
+//      page fault     .
+// HugePageThreshold -      ( )   mmap,
+//   2    transparent huge pages. 0 -   
+// ReleaseOnShrink - Vector    ,  Resize  PopBack
+template <bool Prefault = false, size_t HugePageThreshold = 0, bool ReleaseOnShrink = false>
+struct PagePolicy {
+    static constexpr bool prefault = Prefault;
+    static constexpr size_t huge_page_threshold = HugePageThreshold;
+    static constexpr bool release_on_shrink = ReleaseOnShrink;
+};
 
-template <typename T>
+// Alignment -   ,  64   -  AVX.
+//    max(alignof(T), Alignment)
+template <typename T, typename Policy = PagePolicy<>, size_t Alignment = alignof(T)>
 class RawMemory {
 public:
+    static constexpr size_t ALIGNMENT = std::max(alignof(T), Alignment);
+    static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "Alignment must be a power of two");
+
     RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
+    constexpr explicit RawMemory(size_t capacity)
         : buffer_(Allocate(capacity))
         , capacity_(capacity) {
     }
 
+    //    ,    Release  RawMemory   
+    constexpr RawMemory(T* buffer, size_t capacity) noexcept
+        : buffer_(buffer)
+        , capacity_(capacity) {
+    }
+
     RawMemory(const RawMemory&) = delete;
     RawMemory& operator=(const RawMemory& rhs) = delete;
-    RawMemory(RawMemory&& other) noexcept { Swap(other); }
-    RawMemory& operator=(RawMemory&& rhs) noexcept { Swap(rhs); }
+    constexpr RawMemory(RawMemory&& other) noexcept { Swap(other); }
+    constexpr RawMemory& operator=(RawMemory&& rhs) noexcept { Swap(rhs); return *this; }
 
-    ~RawMemory() {
-        Deallocate(buffer_);
+    constexpr ~RawMemory() {
+        Deallocate(buffer_, capacity_);
     }
 
-    T* operator+(size_t offset) noexcept {
+    constexpr T* operator+(size_t offset) noexcept {
         //     ,     
         assert(offset <= capacity_);
         return buffer_ + offset;
     }
 
-    const T* operator+(size_t offset) const noexcept {
+    constexpr const T* operator+(size_t offset) const noexcept {
         return const_cast<RawMemory&>(*this) + offset;
     }
 
-    const T& operator[](size_t index) const noexcept {
+    constexpr const T& operator[](size_t index) const noexcept {
         return const_cast<RawMemory&>(*this)[index];
     }
 
-    T& operator[](size_t index) noexcept {
+    constexpr T& operator[](size_t index) noexcept {
         assert(index < capacity_);
         return buffer_[index];
     }
 
-    void Swap(RawMemory& other) noexcept {
+    constexpr void Swap(RawMemory& other) noexcept {
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
 
-    const T* GetAddress() const noexcept {
+    //        
+    constexpr T* Release() noexcept {
+        capacity_ = 0;
+        return std::exchange(buffer_, nullptr);
+    }
+
+    constexpr const T* GetAddress() const noexcept {
         return buffer_;
     }
 
-    T* GetAddress() noexcept {
+    constexpr T* GetAddress() noexcept {
         return buffer_;
     }
 
-    size_t Capacity() const {
+    constexpr size_t Capacity() const {
         return capacity_;
     }
 
+    //  true,     mmap    huge page
+    constexpr bool IsMapped() const noexcept {
+        return IsMapped(capacity_);
+    }
+
+    //    ,     [from, to).
+    //      ,     .
+    //    ,   mmap
+    void ReleasePages([[maybe_unused]] size_t from, [[maybe_unused]] size_t to) noexcept {
+#if defined(__linux__)
+        assert(from <= to && to <= capacity_);
+        if (!IsMapped()) {
+            return;
+        }
+        const uintptr_t address = reinterpret_cast<uintptr_t>(buffer_);
+        const uintptr_t first = RoundUp(address + from * sizeof(T), BASE_PAGE_SIZE);
+        //        ,  ,
+        //    to,       
+        const uintptr_t last = to == capacity_
+            ? address + RoundUp(capacity_ * sizeof(T), HUGE_PAGE_SIZE)
+            : (address + to * sizeof(T)) & ~(BASE_PAGE_SIZE - 1);
+        if (first < last) {
+            madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED);
+        }
+#endif
+    }
+
+    static constexpr size_t BASE_PAGE_SIZE = 4096;
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    static_assert(ALIGNMENT <= HUGE_PAGE_SIZE, "Alignment must not exceed the huge page size");
+
 private:
-    //     n      
-    static T* Allocate(size_t n) {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+    static constexpr bool IsMapped(size_t n) noexcept {
+#if defined(__linux__)
+        return Policy::huge_page_threshold != 0 && n != 0 && n * sizeof(T) >= Policy::huge_page_threshold;
+#else
+        return false;
+#endif
+    }
+
+    static constexpr size_t RoundUp(size_t value, size_t alignment) noexcept {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    //     n      .
+    //       std::allocator
+    static constexpr T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        if (std::is_constant_evaluated()) {
+            return std::allocator<T>().allocate(n);
+        }
+        const size_t bytes = n * sizeof(T);
+        const bool mapped = IsMapped(n);
+        void* buf = mapped ? MapPages(bytes) : AllocateAligned(bytes);
+        if constexpr (Policy::prefault) {
+            PrefaultPages(buf, bytes, mapped);
+        }
+        return static_cast<T*>(buf);
     }
 
     //   ,     buf   Allocate
-    static void Deallocate(T* buf) noexcept {
-        operator delete(buf);
+    static constexpr void Deallocate(T* buf, size_t n) noexcept {
+        if (std::is_constant_evaluated()) {
+            if (buf != nullptr) {
+                std::allocator<T>().deallocate(buf, n);
+            }
+        }
+        else if (IsMapped(n)) {
+            UnmapPages(buf, n * sizeof(T));
+        }
+        else {
+            DeallocateAligned(buf);
+        }
+    }
+
+    static void* AllocateAligned(size_t bytes) {
+        if constexpr (ALIGNMENT > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return operator new(bytes, std::align_val_t{ ALIGNMENT });
+        }
+        else {
+            return operator new(bytes);
+        }
+    }
+
+    static void DeallocateAligned(void* buf) noexcept {
+        if constexpr (ALIGNMENT > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            operator delete(buf, std::align_val_t{ ALIGNMENT });
+        }
+        else {
+            operator delete(buf);
+        }
+    }
+
+    //   ,    huge page
+    static void* MapPages(size_t bytes) {
+#if defined(__linux__)
+        const size_t length = RoundUp(bytes, HUGE_PAGE_SIZE);
+        //    huge page ,      
+        void* raw = mmap(nullptr, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        const uintptr_t raw_address = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t address = RoundUp(raw_address, HUGE_PAGE_SIZE);
+        const size_t head = address - raw_address;
+        if (head != 0) {
+            munmap(raw, head);
+        }
+        munmap(reinterpret_cast<void*>(address + length), HUGE_PAGE_SIZE - head);
+#if defined(MADV_HUGEPAGE)
+        madvise(reinterpret_cast<void*>(address), length, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(address);
+#else
+        return AllocateAligned(bytes);
+#endif
+    }
+
+    static void UnmapPages(void* buf, size_t bytes) noexcept {
+#if defined(__linux__)
+        munmap(buf, RoundUp(bytes, HUGE_PAGE_SIZE));
+#else
+        DeallocateAligned(buf);
+#endif
+    }
+
+    //       
+    static void PrefaultPages(void* buf, size_t bytes, [[maybe_unused]] bool mapped) noexcept {
+#if defined(MADV_POPULATE_WRITE)
+        if (mapped && madvise(buf, RoundUp(bytes, HUGE_PAGE_SIZE), MADV_POPULATE_WRITE) == 0) {
+            return;
+        }
+#endif
+        //      . volatile     
+        volatile char* bytes_ptr = static_cast<char*>(buf);
+        for (size_t offset = 0; offset < bytes; offset += BASE_PAGE_SIZE) {
+            bytes_ptr[offset] = 0;
+        }
+        bytes_ptr[bytes - 1] = 0;
     }
 
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
+//  std::uninitialized_*_n,       .
+//   ,       
 template <typename T>
+constexpr void UninitializedValueConstructN(T* first, size_t n) {
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < n; ++i) {
+            std::construct_at(first + i);
+        }
+    }
+    else {
+        std::uninitialized_value_construct_n(first, n);
+    }
+}
+
+template <typename T>
+constexpr void UninitializedCopyN(const T* first, size_t n, T* dest) {
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < n; ++i) {
+            std::construct_at(dest + i, first[i]);
+        }
+    }
+    else {
+        std::uninitialized_copy_n(first, n, dest);
+    }
+}
+
+template <typename T>
+constexpr void UninitializedMoveN(T* first, size_t n, T* dest) {
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < n; ++i) {
+            std::construct_at(dest + i, std::move(first[i]));
+        }
+    }
+    else {
+        std::uninitialized_move_n(first, n, dest);
+    }
+}
+
+template <typename T, typename Policy = PagePolicy<>, size_t Alignment = alignof(T)>
 class Vector {
 public:
 
     using iterator = T*;
     using const_iterator = const T*;
 
-    iterator begin() noexcept {
+    constexpr iterator begin() noexcept {
         return data_.GetAddress();
     }
 
-    iterator end() noexcept {
+    constexpr iterator end() noexcept {
         return data_.GetAddress() + size_;
     }
 
-    const_iterator begin() const noexcept {
+    constexpr const_iterator begin() const noexcept {
         return data_.GetAddress();
     }
 
-    const_iterator end() const noexcept {
+    constexpr const_iterator end() const noexcept {
         return data_.GetAddress() + size_;
     }
 
-    const_iterator cbegin() const noexcept {
+    constexpr const_iterator cbegin() const noexcept {
         return data_.GetAddress();
     }
 
-    const_iterator cend() const noexcept {
+    constexpr const_iterator cend() const noexcept {
         return data_.GetAddress() + size_;
     }
 
-    Vector() = default;
+    constexpr Vector() = default;
 
-    explicit Vector(size_t size) : data_(size), size_(size)
+    constexpr explicit Vector(size_t size) : data_(size), size_(size)
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        UninitializedValueConstructN(data_.GetAddress(), size);
     }
 
-    Vector(const Vector& other) : data_(other.size_), size_(other.size_)
+    constexpr Vector(const Vector& other) : data_(other.size_), size_(other.size_)
     {
-        std::uninitialized_copy_n(other.data_.GetAddress(), size_, data_.GetAddress());
+        UninitializedCopyN(other.data_.GetAddress(), size_, data_.GetAddress());
     }
 
-    Vector(Vector&& other) noexcept {
+    constexpr Vector(Vector&& other) noexcept {
         Swap(other);
     }
 
-    Vector& operator=(const Vector& rhs) {
+    constexpr Vector& operator=(const Vector& rhs) {
         if (this != &rhs) {
             if (rhs.size_ > data_.Capacity()) {
                 Vector rhs_copy(rhs);
@@ -139,7 +345,7 @@ public:
                 }
                 else {
                     copy_size = size_;
-                    std::uninitialized_copy_n(rhs.data_.GetAddress() + size_, rhs.size_ - size_, data_.GetAddress() + size_);
+                    UninitializedCopyN(rhs.data_.GetAddress() + size_, rhs.size_ - size_, data_.GetAddress() + size_);
                 }
 
                 std::copy_n(rhs.data_.GetAddress(), copy_size, data_.GetAddress());
@@ -149,33 +355,33 @@ public:
         return *this;
     }
 
-    Vector& operator=(Vector&& rhs) noexcept {
+    constexpr Vector& operator=(Vector&& rhs) noexcept {
         Swap(rhs);
         return *this;
     }
 
-    void Swap(Vector& other) noexcept {
+    constexpr void Swap(Vector& other) noexcept {
         data_.Swap(other.data_);
         std::swap(size_, other.size_);
     }
 
-    ~Vector() {
+    constexpr ~Vector() {
         std::destroy_n(data_.GetAddress(), size_);
     }
 
-    size_t Size() const noexcept {
+    constexpr size_t Size() const noexcept {
         return size_;
     }
 
-    size_t Capacity() const noexcept {
+    constexpr size_t Capacity() const noexcept {
         return data_.Capacity();
     }
 
-    void Reserve(size_t new_capacity) {
+    constexpr void Reserve(size_t new_capacity) {
         if (new_capacity <= Capacity()) {
             return;
         }
-        RawMemory<T> new_data(new_capacity);
+        RawMemory<T, Policy, Alignment> new_data(new_capacity);
 
         MoveOrCopyData(data_, new_data, size_);
 
@@ -183,31 +389,36 @@ public:
         data_.Swap(new_data);
     }
 
-    void Resize(size_t new_size) {
+    constexpr void Resize(size_t new_size) {
         if (new_size < size_) {
             std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+            if constexpr (Policy::release_on_shrink) {
+                //   size_  :     ,
+                //     
+                data_.ReleasePages(new_size, data_.Capacity());
+            }
         }
         else {
             Reserve(new_size);
-            std::uninitialized_value_construct_n(data_.GetAddress() + size_, new_size - size_);
+            UninitializedValueConstructN(data_.GetAddress() + size_, new_size - size_);
         }
         size_ = new_size;
     }
 
-    void PushBack(const T& value) {
+    constexpr void PushBack(const T& value) {
         EmplaceBack(value);
     }
 
-    void PushBack(T&& value) {
+    constexpr void PushBack(T&& value) {
         EmplaceBack(std::move(value));
     }
 
     template <typename... Args>
-    T& EmplaceBack(Args&&... args) {
+    constexpr T& EmplaceBack(Args&&... args) {
         T* value_ = nullptr;
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-            value_ = new (new_data + size_) T(std::forward <Args>(args) ...);
+            RawMemory<T, Policy, Alignment> new_data(size_ == 0 ? 1 : size_ * 2);
+            value_ = std::construct_at(new_data + size_, std::forward <Args>(args) ...);
 
             MoveOrCopyData(data_, new_data, size_);
 
@@ -215,76 +426,99 @@ public:
             data_.Swap(new_data);
         }
         else {
-            value_ = new (data_ + size_) T(std::forward <Args>(args) ...);
+            value_ = std::construct_at(data_ + size_, std::forward <Args>(args) ...);
         }
         ++size_;
         return *value_;
     }
 
-    void PopBack() noexcept {
+    constexpr void PopBack() noexcept {
         std::destroy_at(end() - 1);
         --size_;
+        if constexpr (Policy::release_on_shrink) {
+            //  ,          ,
+            //            .
+            //    size_ ,     
+            constexpr uintptr_t PAGE_SIZE = RawMemory<T, Policy, Alignment>::BASE_PAGE_SIZE;
+            const uintptr_t live_end = reinterpret_cast<uintptr_t>(data_.GetAddress() + size_);
+            if ((live_end + PAGE_SIZE - 1) / PAGE_SIZE != (live_end + sizeof(T) + PAGE_SIZE - 1) / PAGE_SIZE) {
+                data_.ReleasePages(size_, data_.Capacity());
+            }
+        }
+    }
+
+    //        :  
+    //  .   ,     .
+    //    ,  CowVector     ,
+    //    
+    std::shared_ptr<const Vector> Freeze() && {
+        return std::make_shared<Vector>(std::move(*this));
+    }
+
+    //       Size(),     
+    void ReleaseUnusedPages() noexcept {
+        data_.ReleasePages(size_, data_.Capacity());
     }
 
     template <typename... Args>
-    iterator Emplace(const_iterator pos, Args&&... args) {
+    constexpr iterator Emplace(const_iterator pos, Args&&... args) {
         if (size_ == Capacity()) {
             return EmplaceRealloc(pos, std::forward <Args>(args) ...);
         }
         return EmplaceMove(pos, std::forward <Args>(args) ...);
     }
 
-    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    constexpr iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
         iterator pos_ = const_cast<iterator>(pos);
         std::move(pos_ + 1, end(), pos_);
         PopBack();
         return pos_;
     }
 
-    iterator Insert(const_iterator pos, const T& value) {
+    constexpr iterator Insert(const_iterator pos, const T& value) {
         return Emplace(pos, value);
     }
 
-    iterator Insert(const_iterator pos, T&& value) {
+    constexpr iterator Insert(const_iterator pos, T&& value) {
         return Emplace(pos, std::move(value));
     }
 
-    const T& operator[](size_t index) const noexcept {
+    constexpr const T& operator[](size_t index) const noexcept {
         return const_cast<Vector&>(*this)[index];
     }
 
-    T& operator[](size_t index) noexcept {
+    constexpr T& operator[](size_t index) noexcept {
         assert(index < size_);
         return data_[index];
     }
 
 private:
-    RawMemory<T> data_;
+    RawMemory<T, Policy, Alignment> data_;
     size_t size_ = 0;
 
-    void MoveOrCopyData(RawMemory<T>& data, RawMemory<T>& new_data, size_t size) {
+    constexpr void MoveOrCopyData(RawMemory<T, Policy, Alignment>& data, RawMemory<T, Policy, Alignment>& new_data, size_t size) {
         // constexpr  if     
         if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data.GetAddress(), size, new_data.GetAddress());
+            UninitializedMoveN(data.GetAddress(), size, new_data.GetAddress());
         }
         else {
-            std::uninitialized_copy_n(data.GetAddress(), size, new_data.GetAddress());
+            UninitializedCopyN(data.GetAddress(), size, new_data.GetAddress());
         }
     }
 
     template <typename... Args>
-    iterator EmplaceRealloc(const_iterator pos, Args&&... args) {
+    constexpr iterator EmplaceRealloc(const_iterator pos, Args&&... args) {
         size_t index_ = pos - begin();
         iterator value_ptr = nullptr;
 
-        RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-        value_ptr = new (new_data + index_) T(std::forward <Args>(args) ...);
+        RawMemory<T, Policy, Alignment> new_data(size_ == 0 ? 1 : size_ * 2);
+        value_ptr = std::construct_at(new_data + index_, std::forward <Args>(args) ...);
         if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(begin(), index_, new_data.GetAddress());
+            UninitializedMoveN(begin(), index_, new_data.GetAddress());
         }
         else {
             try {
-                std::uninitialized_copy_n(begin(), index_, new_data.GetAddress());
+                UninitializedCopyN(begin(), index_, new_data.GetAddress());
             }
             catch (...) {
                 std::destroy_at(new_data.GetAddress() + index_);
@@ -292,11 +526,11 @@ private:
             }
         }
         if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(begin() + index_, size_ - index_, new_data.GetAddress() + index_ + 1);
+            UninitializedMoveN(begin() + index_, size_ - index_, new_data.GetAddress() + index_ + 1);
         }
         else {
             try {
-                std::uninitialized_copy_n(begin() + index_, size_ - index_, new_data.GetAddress() + index_ + 1);
+                UninitializedCopyN(begin() + index_, size_ - index_, new_data.GetAddress() + index_ + 1);
             }
             catch (...) {
                 std::destroy_n(new_data.GetAddress(), index_);
@@ -311,24 +545,46 @@ private:
     }
 
     template <typename... Args>
-    iterator EmplaceMove(const_iterator pos, Args&&... args) {
+    constexpr iterator EmplaceMove(const_iterator pos, Args&&... args) {
         size_t index_ = pos - begin();
-        iterator value_ptr = nullptr;
 
-        if (size_ != 0) {
-            new (data_ + size_) T(std::move(*(begin() + size_ - 1)));
-            try {
-                std::move_backward(begin() + index_, begin() + size_, begin() + size_ + 1);
-            }
-            catch (...) {
-                std::destroy_at(begin() + size_);
-                throw;
-            }
-            std::destroy_at(begin() + index_);
+        if (index_ == size_) {
+            std::construct_at(data_ + size_, std::forward <Args>(args) ...);
+            ++size_;
+            return begin() + index_;
+        }
+        //      ,     
+        T value(std::forward <Args>(args) ...);
+        std::construct_at(data_ + size_, std::move(*(begin() + size_ - 1)));
+        try {
+            std::move_backward(begin() + index_, begin() + size_ - 1, begin() + size_);
         }
-        value_ptr = new (data_ + index_) T(std::forward <Args>(args) ...);
+        catch (...) {
+            std::destroy_at(begin() + size_);
+            throw;
+        }
+        data_[index_] = std::move(value);
 
         ++size_;
-        return value_ptr;
+        return begin() + index_;
     }
-};
\ No newline at end of file
+};
+
+// ,     Alignment 
+template <typename T, size_t Alignment>
+using AlignedVector = Vector<T, PagePolicy<>, Alignment>;
+
+//  Vector,   Build   ,  std::array.
+// Build -     ,   Vector    
+//   . ,   ,    ,
+//   Vector    ,      :
+// static constexpr auto table = MaterializeVector<[] { Vector<int> v; ...; return v; }>();
+template <auto Build>
+constexpr auto MaterializeVector() {
+    using T = std::remove_cvref_t<decltype(*Build().begin())>;
+    constexpr size_t size = Build().Size();
+    std::array<T, size> result{};
+    const auto vector = Build();
+    std::copy(vector.begin(), vector.end(), result.begin());
+    return result;
+}
\ No newline at end of file